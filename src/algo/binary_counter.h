@@ -20,6 +20,7 @@
 #include <array>
 #include <iterator>
 #include <utility>
+#include <vector>
 
 #include <algorithm>
 #include <iostream>
@@ -122,6 +123,11 @@ class binary_counter_fixed : Op {
     return reduce_counter(begin(), end(), operation(), zero_);
   }
 
+  // All digits are zero, the number of digits stays.
+  constexpr void clear() {
+    for (auto& digit : *this) digit = value_type(zero_);
+  }
+
   constexpr std::pair<iterator, iterator> significant_digits() {
     return {begin(), last_significant_digit(begin(), end(), zero_)};
   }
@@ -140,6 +146,66 @@ class binary_counter_fixed : Op {
   constexpr const_iterator cend() const { return end(); }
 };
 
+template <typename Op, typename T = std::decay_t<ArgumentType<Op>>,
+          typename U = T>
+class binary_counter : Op {
+  std::vector<T> body_;
+  U zero_;
+
+ public:
+  using value_type = T;
+  using zero_type = U;
+  using reference = T&;
+  using const_reference = const T&;
+  using operation_type = Op;
+
+  using iterator = typename std::vector<T>::iterator;
+  using const_iterator = typename std::vector<T>::const_iterator;
+  using reverse_iterator = typename std::vector<T>::reverse_iterator;
+  using const_reverse_iterator =
+      typename std::vector<T>::const_reverse_iterator;
+
+  binary_counter(operation_type op, zero_type zero)
+      : Op(op), zero_(std::move(zero)) {}
+
+  void reserve(size_t n) {
+    while (body_.size() < n) body_.push_back(value_type(zero_));
+  }
+
+  operation_type operation() const { return *this; }
+
+  void add(value_type x) {
+    x = add_to_counter(begin(), end(), operation(), zero_, std::move(x));
+    if (x == zero_) return;
+    body_.push_back(std::move(x));
+  }
+
+  value_type reduce() {
+    return reduce_counter(begin(), end(), operation(), zero_);
+  }
+
+  // All digits are zero, the number of digits stays.
+  void clear() {
+    for (auto& digit : body_) digit = value_type(zero_);
+  }
+
+  std::pair<iterator, iterator> significant_digits() {
+    return {begin(), last_significant_digit(begin(), end(), zero_)};
+  }
+
+  std::pair<const_iterator, const_iterator> significant_digits() const {
+    return {begin(), last_significant_digit(begin(), end(), zero_)};
+  }
+
+  iterator begin() { return body_.begin(); }
+  const_iterator begin() const { return body_.begin(); }
+  const_iterator cbegin() const { return body_.begin(); }
+
+  iterator end() { return body_.end(); }
+  const_iterator end() const { return body_.end(); }
+  const_iterator cend() const { return body_.end(); }
+};
+
 }  // namespace algo
 
 #endif  // BINARY_COUNTER_H
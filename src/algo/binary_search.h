@@ -17,8 +17,14 @@
 #ifndef ALGO_BINARY_SEARCH_H
 #define ALGO_BINARY_SEARCH_H
 
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
 #include "algo/half_nonnegative.h"
 #include "algo/type_functions.h"
+#include "compiler/compiler_directives.h"
 
 namespace algo {
 
@@ -38,6 +44,51 @@ constexpr I partition_point_n(I f, DifferenceType<I> n, P p) {
   return f;
 }
 
+// Same as partition_point_n but also returns the distance from f to the
+// partition point. For non random access iterators computing it afterwards
+// would mean another walk over the range.
+template <typename I, typename P>
+// require ForwardIterator<I> && UnaryPredicate<P, ValueType<I>>
+constexpr std::pair<I, DifferenceType<I>> partition_point_n_counting(
+    I f, DifferenceType<I> n, P p) {
+  DifferenceType<I> rank = 0;
+  while (n) {
+    DifferenceType<I> n2 = half_nonnegative(n);
+    I m = std::next(f, n2);
+    if (p(*m)) {
+      f = ++m;
+      n -= n2 + 1;
+      rank += n2 + 1;
+    } else {
+      n = n2;
+    }
+  }
+  return {f, rank};
+}
+
+// One step of a branchless partition_point_n.
+// The partition point is in [f, f + n] before the step and in
+// [result, result + n - half_nonnegative(n)] after.
+// How n changes doesn't depend on the predicate, so multiple searches over
+// the same range can do steps at the same time.
+template <typename I, typename P>
+// require RandomAccessIterator<I> && UnaryPredicate<P, ValueType<I>>
+constexpr I partition_point_n_branchless_step(I f, DifferenceType<I> n, P p) {
+  I m = f + half_nonnegative(n);
+  return p(*m) ? m : f;
+}
+
+template <typename I, typename P>
+// require RandomAccessIterator<I> && UnaryPredicate<P, ValueType<I>>
+constexpr I partition_point_n_branchless(I f, DifferenceType<I> n, P p) {
+  if (!n) return f;
+  while (n > 1) {
+    f = algo::partition_point_n_branchless_step(f, n, p);
+    n -= half_nonnegative(n);
+  }
+  return p(*f) ? f + 1 : f;
+}
+
 template <typename I, typename P>
 // require ForwardIterator<I> && UnaryPredicate<P, ValueType<I>>
 constexpr I partition_point(I f, I l, P p) {
@@ -56,6 +107,21 @@ constexpr I lower_bound_n(I f, DifferenceType<I> n, const V& v) {
   return algo::lower_bound_n(f, n, v, std::less<>{});
 }
 
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr std::pair<I, DifferenceType<I>> lower_bound_n_counting(
+    I f, DifferenceType<I> n, const V& v, Comp comp) {
+  return algo::partition_point_n_counting(
+      f, n, [&](Reference<I> x) { return comp(x, v); });
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr std::pair<I, DifferenceType<I>> lower_bound_n_counting(
+    I f, DifferenceType<I> n, const V& v) {
+  return algo::lower_bound_n_counting(f, n, v, std::less<>{});
+}
+
 template <typename I, typename V, typename Comp>
 // require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
 constexpr I lower_bound(I f, I l, const V& v, Comp comp) {
@@ -68,6 +134,152 @@ constexpr I lower_bound(I f, I l, const V& v) {
   return algo::lower_bound(f, l, v, std::less<>{});
 }
 
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr I upper_bound_n(I f, DifferenceType<I> n, const V& v, Comp comp) {
+  return algo::partition_point_n(f, n,
+                                 [&](Reference<I> x) { return !comp(v, x); });
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr I upper_bound_n(I f, DifferenceType<I> n, const V& v) {
+  return algo::upper_bound_n(f, n, v, std::less<>{});
+}
+
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr I upper_bound(I f, I l, const V& v, Comp comp) {
+  return algo::upper_bound_n(f, std::distance(f, l), v, comp);
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr I upper_bound(I f, I l, const V& v) {
+  return algo::upper_bound(f, l, v, std::less<>{});
+}
+
+namespace detail {
+
+// Exponential search that can't go further than n elements.
+template <typename I, typename P>
+// require ForwardIterator<I> && UnaryPredicate<P, ValueType<I>>
+constexpr I partition_point_galloping_n(I f, DifferenceType<I> n, P p) {
+  DifferenceType<I> step = 1;
+  while (n) {
+    if (step > n) step = n;
+    I test = std::next(f, step - 1);
+    if (!p(*test)) return algo::partition_point_n(f, step - 1, p);
+    f = ++test;
+    n -= step;
+    step += step;
+  }
+  return f;
+}
+
+}  // namespace detail
+
+// The search is shared until the first element equal to v.
+// Then lower bound is searched on the left and the upper bound is galloped
+// to on the right: runs of equal elements are usually short.
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_n(I f, DifferenceType<I> n, const V& v,
+                                        Comp comp) {
+  while (n) {
+    DifferenceType<I> n2 = half_nonnegative(n);
+    I m = std::next(f, n2);
+    if (comp(*m, v)) {
+      f = ++m;
+      n -= n2 + 1;
+    } else if (comp(v, *m)) {
+      n = n2;
+    } else {
+      I lo = algo::lower_bound_n(f, n2, v, comp);
+      I hi = detail::partition_point_galloping_n(
+          ++m, n - n2 - 1, [&](Reference<I> x) { return !comp(v, x); });
+      return {lo, hi};
+    }
+  }
+  return {f, f};
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_n(I f, DifferenceType<I> n,
+                                        const V& v) {
+  return algo::equal_range_n(f, n, v, std::less<>{});
+}
+
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr std::pair<I, I> equal_range(I f, I l, const V& v, Comp comp) {
+  return algo::equal_range_n(f, std::distance(f, l), v, comp);
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr std::pair<I, I> equal_range(I f, I l, const V& v) {
+  return algo::equal_range(f, l, v, std::less<>{});
+}
+
+// Number of searches lower_bound_batch does at the same time.
+constexpr std::size_t kLowerBoundBatchGroup = 16;
+
+// Looks up lower_bound of every key and writes it to `o`.
+//
+// A binary search is a chain of dependent loads, for big ranges each one is
+// a cache miss. Here a group of searches goes in lockstep: every search
+// prefetches its next probe and by the time we get back to it the other
+// searches in the group had their turn, so the cache misses overlap.
+template <typename I, typename KeysI, typename O, typename Comp>
+// require RandomAccessIterator<I> && ForwardIterator<KeysI> &&
+//         OutputIterator<O, I> &&
+//         StrictWeakOrdering<Comp, ValueType<I>, ValueType<KeysI>>
+O lower_bound_batch(I f, I l, KeysI keys_f, KeysI keys_l, O o, Comp comp) {
+  const DifferenceType<I> n = std::distance(f, l);
+
+  std::array<KeysI, kLowerBoundBatchGroup> keys;
+  std::array<I, kLowerBoundBatchGroup> found;
+
+  while (keys_f != keys_l) {
+    std::size_t size = 0;
+    for (; size != kLowerBoundBatchGroup && keys_f != keys_l; ++size) {
+      keys[size] = keys_f++;
+      found[size] = f;
+    }
+
+    for (DifferenceType<I> step_n = n; step_n > 1;) {
+      const DifferenceType<I> next_n = step_n - half_nonnegative(step_n);
+      const DifferenceType<I> next_probe = half_nonnegative(next_n);
+
+      for (std::size_t i = 0; i != size; ++i) {
+        found[i] = algo::partition_point_n_branchless_step(
+            found[i], step_n,
+            [&](Reference<I> x) { return comp(x, *keys[i]); });
+        ALGO_PREFETCH(&*(found[i] + next_probe));
+      }
+
+      step_n = next_n;
+    }
+
+    for (std::size_t i = 0; i != size; ++i) {
+      if (n && comp(*found[i], *keys[i])) ++found[i];
+      *o++ = found[i];
+    }
+  }
+
+  return o;
+}
+
+template <typename I, typename KeysI, typename O>
+// require RandomAccessIterator<I> && ForwardIterator<KeysI> &&
+//         OutputIterator<O, I> &&
+//         TotallyOrdered<ValueType<I>, ValueType<KeysI>>
+O lower_bound_batch(I f, I l, KeysI keys_f, KeysI keys_l, O o) {
+  return algo::lower_bound_batch(f, l, keys_f, keys_l, o, std::less<>{});
+}
+
 }  // namespace algo
 
 #endif  // ALGO_BINARY_SEARCH_H
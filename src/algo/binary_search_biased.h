@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <utility>
 
 #include "algo/advance_up_to.h"
 #include "algo/binary_search.h"
@@ -151,6 +152,33 @@ constexpr I lower_bound_biased(I f, I l, const V& v) {
   return lower_bound_biased(f, l, v, std::less<>{});
 }
 
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr I upper_bound_biased(I f, I l, const V& v, Comp comp) {
+  return partition_point_biased(f, l,
+                                [&](Reference<I> x) { return !comp(v, x); });
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr I upper_bound_biased(I f, I l, const V& v) {
+  return upper_bound_biased(f, l, v, std::less<>{});
+}
+
+// Gallops from the lower bound to the upper bound.
+template <typename I, typename V, typename Comp>
+// require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_biased(I f, I l, const V& v, Comp comp) {
+  I lo = lower_bound_biased(f, l, v, comp);
+  return {lo, upper_bound_biased(lo, l, v, comp)};
+}
+
+template <typename I, typename V>
+// require ForwardIterator<I> && TotallyOrdered<ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_biased(I f, I l, const V& v) {
+  return equal_range_biased(f, l, v, std::less<>{});
+}
+
 template <typename I, typename V, typename Comp>
 // require InputIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
 I lower_bound_linear(I f, I l, const V& v, Comp comp) {
@@ -177,6 +205,34 @@ constexpr I lower_bound_hinted(I f, I h, I l, const V& v) {
   return lower_bound_hinted(f, h, l, v, std::less<>{});
 }
 
+template <typename I, typename V, typename Comp>
+// requires BidirectionalIterator<I> && WeakComarable<ValueType<I>, V>
+constexpr I upper_bound_hinted(I f, I h, I l, const V& v, Comp comp) {
+  return partition_point_hinted(f, h, l,
+                                [&](Reference<I> x) { return !comp(v, x); });
+}
+
+template <typename I, typename V>
+// requires BidirectionalIterator<I> && WeakComarable<ValueType<I>, V>
+constexpr I upper_bound_hinted(I f, I h, I l, const V& v) {
+  return upper_bound_hinted(f, h, l, v, std::less<>{});
+}
+
+// Gallops from the lower bound to the upper bound.
+template <typename I, typename V, typename Comp>
+// requires BidirectionalIterator<I> && WeakComarable<ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_hinted(I f, I h, I l, const V& v,
+                                             Comp comp) {
+  I lo = lower_bound_hinted(f, h, l, v, comp);
+  return {lo, upper_bound_biased(lo, l, v, comp)};
+}
+
+template <typename I, typename V>
+// requires BidirectionalIterator<I> && WeakComarable<ValueType<I>, V>
+constexpr std::pair<I, I> equal_range_hinted(I f, I h, I l, const V& v) {
+  return equal_range_hinted(f, h, l, v, std::less<>{});
+}
+
 template <typename I, typename V, typename Comp>
 // require ForwardIterator<I> && StrictWeakOrdering<Comp, ValueType<I>, V>
 constexpr I point_closer_to_lower_bound(I f, I l, const V& v, Comp comp) {
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ALGO_EYTZINGER_H
+#define ALGO_EYTZINGER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "algo/type_functions.h"
+#include "compiler/compiler_directives.h"
+#include "simd/bits.h"
+
+namespace algo {
+namespace _eytzinger {
+
+// Depth of a node in a binary heap (1 based indexes).
+inline std::size_t depth(std::size_t k) {
+  return static_cast<std::size_t>(
+      63 - simd::count_leading_zeroes(static_cast<std::uint64_t>(k)));
+}
+
+// Position of the node k in sorted order.
+//
+// A heap of size n is a perfect tree of height h, with l = n - (2^h - 1)
+// nodes on the last level. In the perfect tree of height h + 1 every other
+// node in order is a leaf, the rest are the nodes above.
+// All of the nodes above are present, only the first l of the leaves.
+inline std::size_t rank(std::size_t k, std::size_t n) {
+  const std::size_t h = depth(n);
+  const std::size_t d = depth(k);
+  const std::size_t last_level = n - ((std::size_t{1} << h) - 1);
+
+  const std::size_t in_perfect_tree =
+      ((2 * (k - (std::size_t{1} << d)) + 1) << (h - d)) - 1;
+  return in_perfect_tree / 2 + std::min(last_level, (in_perfect_tree + 1) / 2);
+}
+
+template <typename I, typename T>
+void build(I& f, std::vector<T>& body, std::size_t k) {
+  if (k >= body.size()) return;
+  build(f, body, 2 * k);
+  body[k] = *f;
+  ++f;
+  build(f, body, 2 * k + 1);
+}
+
+}  // namespace _eytzinger
+
+// Sorted data in the order of a breadth first traversal of a binary search
+// tree (like a binary heap): the first few levels that every search goes
+// through are close together and the next levels are prefetched.
+// See https://algorithmica.org/en/eytzinger
+//
+// Immutable, lower_bound returns the position in sorted order.
+template <typename T>
+// require Regular<T>
+class eytzinger {
+  std::vector<T> body_;  // 1 based, body_[0] is not used.
+
+ public:
+  using value_type = T;
+
+  eytzinger() : body_(1) {}
+
+  template <typename I>
+  // require ForwardIterator<I> && ValueType<I> == T && sorted(f, l)
+  eytzinger(I f, I l)
+      : body_(static_cast<std::size_t>(std::distance(f, l)) + 1) {
+    _eytzinger::build(f, body_, 1);
+  }
+
+  std::size_t size() const { return body_.size() - 1; }
+
+  // Number of elements less than v.
+  template <typename V>
+  // require TotallyOrdered<T, V>
+  std::size_t lower_bound(const V& v) const {
+    const std::size_t n = size();
+    const T* body = body_.data();
+
+    std::size_t k = 1;
+    while (k <= n) {
+      // 4 levels down, for ints that's one cache line.
+      ALGO_PREFETCH(body + std::min(16 * k, n));
+      k = 2 * k + static_cast<std::size_t>(body[k] < v);
+    }
+
+    // Going right means the element was less than v. The last time we went
+    // left is the lower bound: drop the trailing rights and that left.
+    k >>= simd::count_trailing_zeroes(static_cast<std::uint64_t>(~k)) + 1;
+    if (k == 0) return n;
+    return _eytzinger::rank(k, n);
+  }
+};
+
+}  // namespace algo
+
+#endif  // ALGO_EYTZINGER_H
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_FINGER_SEARCH_H
+#define ALGO_FINGER_SEARCH_H
+
+#include <functional>
+
+#include "algo/binary_search_biased.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Remembers where the last search ended and starts the next one from there.
+// Good for queries that arrive in (nearly) sorted order.
+template <typename I, typename Comp = std::less<>>
+// require BidirectionalIterator<I> && StrictWeakOrdering<Comp, ValueType<I>>
+class finger_search {
+ public:
+  finger_search(I f, I l) : finger_search(f, l, Comp{}) {}
+  finger_search(I f, I l, Comp comp) : f_(f), finger_(f), l_(l), comp_(comp) {}
+
+  I finger() const { return finger_; }
+
+  // lower_bound of v, searches from the finger in both directions.
+  template <typename V>
+  // require TotallyOrdered<ValueType<I>, V>
+  I seek(const V& v) {
+    finger_ = algo::lower_bound_hinted(f_, finger_, l_, v, comp_);
+    return finger_;
+  }
+
+  // Writes seek(key) for every key.
+  // While keys don't decrease (like merge does) only searches forward.
+  template <typename KeysI, typename O>
+  // require ForwardIterator<KeysI> && OutputIterator<O, I> &&
+  //         StrictWeakOrdering<Comp, ValueType<KeysI>>
+  O seek_all(KeysI keys_f, KeysI keys_l, O o) {
+    if (keys_f == keys_l) return o;
+
+    *o++ = seek(*keys_f);
+    for (KeysI prev = keys_f++; keys_f != keys_l; prev = keys_f++) {
+      if (comp_(*keys_f, *prev)) {
+        *o++ = seek(*keys_f);
+        continue;
+      }
+      finger_ = algo::lower_bound_biased(finger_, l_, *keys_f, comp_);
+      *o++ = finger_;
+    }
+    return o;
+  }
+
+ private:
+  I f_;
+  I finger_;
+  I l_;
+  Comp comp_;
+};
+
+}  // namespace algo
+
+#endif  // ALGO_FINGER_SEARCH_H
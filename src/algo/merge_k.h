@@ -0,0 +1,294 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_MERGE_K_H
+#define ALGO_MERGE_K_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algo/binary_search_biased.h"
+#include "algo/copy.h"
+#include "algo/merge.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// After this many outputs in a row from the same run merge_k gallops.
+inline constexpr std::size_t merge_k_gallop_after = 8;
+
+namespace detail {
+
+// Nodes of the loser tree: head of a run and the run's index.
+// A game is one comparison: players are ordered by the run index first,
+// the later run wins only if it's strictly less, so equal heads go to the
+// earlier run.
+// Small trivially copyable heads are stored in the node (nodes are default
+// constructed, so they have to be default constructible) and the winner is
+// selected by indexing, not by a branch.
+// Other heads are stored by pointer. Comparing them is expensive and
+// selecting by index makes every game wait for the previous comparison,
+// so the winner is swapped up with a branch (faster for fake_url, see the
+// merge_k benchmark).
+template <typename T, typename R, typename = void>
+struct loser_tree_nodes {
+  using head_type =
+      std::conditional_t<std::is_trivially_copyable_v<T> &&
+                             std::is_default_constructible_v<T> &&
+                             sizeof(T) <= 16,
+                         T, const T*>;
+
+  struct node {
+    head_type head;
+    std::size_t run;
+  };
+
+  R r;
+
+  static const T& head(const node& x) {
+    if constexpr (std::is_pointer_v<head_type>) {
+      return *x.head;
+    } else {
+      return x.head;
+    }
+  }
+
+  node make(const T& head, std::size_t run) const {
+    if constexpr (std::is_pointer_v<head_type>) {
+      return {std::addressof(head), run};
+    } else {
+      return {head, run};
+    }
+  }
+
+  static std::size_t run(const node& x) { return x.run; }
+
+  bool beats(const node& a, const node& b) const {
+    const bool a_is_earlier = a.run < b.run;
+    const node& later = a_is_earlier ? b : a;
+    const node& earlier = a_is_earlier ? a : b;
+    return r(head(later), head(earlier)) ^ a_is_earlier;
+  }
+
+  // Stored loses to up: winner goes to up, the loser is stored.
+  void play(node& stored, node& up) const {
+    const bool up_wins = beats(up, stored);
+    if constexpr (std::is_pointer_v<head_type>) {
+      if (!up_wins) std::swap(stored, up);
+    } else {
+      const node players[2] = {stored, up};
+      stored = players[!up_wins];
+      up = players[up_wins];
+    }
+  }
+};
+
+// Integers up to 32 bits with std::less: head and run are packed into one
+// 64 bit number, a game is one unsigned comparison + xor masking.
+template <typename T, typename R>
+struct loser_tree_nodes<
+    T, R,
+    std::enable_if_t<std::is_integral_v<T> && sizeof(T) <= 4 &&
+                     (std::is_same_v<R, std::less<>> ||
+                      std::is_same_v<R, std::less<T>>)>> {
+  using node = std::uint64_t;
+
+  R r;
+
+  node make(const T& head, std::size_t run) const {
+    std::uint32_t key = static_cast<std::uint32_t>(head);
+    if constexpr (std::is_signed_v<T>) {
+      key = static_cast<std::uint32_t>(static_cast<std::int32_t>(head)) ^
+            0x80000000u;
+    }
+    return (static_cast<node>(key) << 32) | static_cast<node>(run);
+  }
+
+  static std::size_t run(node x) { return static_cast<std::uint32_t>(x); }
+
+  bool beats(node a, node b) const { return a < b; }
+
+  void play(node& stored, node& up) const {
+    const node swap_mask =
+        (stored ^ up) & (node{0} - static_cast<node>(stored < up));
+    stored ^= swap_mask;
+    up ^= swap_mask;
+  }
+};
+
+// Tournament tree where every internal node stores the loser of the game
+// played there and the winner goes up. Runs are leaves k..2k-1, nodes are
+// 1..k-1, the overall winner is in 0.
+// When the winner changes, only the games on it's path are replayed and
+// each one is against a single stored loser: no sibling lookups, and the
+// heads are in the nodes, so games don't go through the runs' iterators.
+//
+// Only non empty runs are in the tree, so games don't have to check for
+// the end. Exhausted run is removed and the tree is rebuilt: this happens
+// at most k times.
+template <typename I, typename R>
+class loser_tree {
+  using nodes = loser_tree_nodes<ValueType<I>, R>;
+  using node = typename nodes::node;
+
+  std::vector<I> fs_;
+  std::vector<I> ls_;
+  std::vector<node> tree_;
+  nodes nodes_;  // Has the comparator.
+
+  node leaf(std::size_t run) const { return nodes_.make(*fs_[run], run); }
+
+  void build() {
+    const std::size_t k = size();
+    tree_.resize(k);
+    if (!k) return;
+
+    std::vector<node> winners(2 * k);
+    for (std::size_t i = 0; i != k; ++i) winners[k + i] = leaf(i);
+    for (std::size_t i = k - 1; i; --i) {
+      node stored = winners[2 * i];
+      node up = winners[2 * i + 1];
+      nodes_.play(stored, up);
+      winners[i] = up;
+      tree_[i] = stored;
+    }
+    tree_[0] = winners[1];
+  }
+
+ public:
+  template <typename Ranges>
+  loser_tree(const Ranges& ranges, R r) : nodes_{r} {
+    for (const auto& range : ranges) {
+      if (range.first == range.second) continue;
+      fs_.push_back(range.first);
+      ls_.push_back(range.second);
+    }
+    build();
+  }
+
+  std::size_t size() const { return fs_.size(); }
+
+  std::size_t winner() const { return nodes::run(tree_[0]); }
+
+  I& run_f(std::size_t i) { return fs_[i]; }
+  I run_l(std::size_t i) const { return ls_[i]; }
+
+  // Best of the rest: the winner beat it somewhere on it's path.
+  // Requires at least 2 runs.
+  std::size_t runner_up() const {
+    std::size_t i = (winner() + size()) / 2;
+    node best = tree_[i];
+    for (i /= 2; i; i /= 2) {
+      if (nodes_.beats(tree_[i], best)) best = tree_[i];
+    }
+    return nodes::run(best);
+  }
+
+  // The head of the winner `w` has changed.
+  void replay(std::size_t w) {
+    const I f = fs_[w];
+    if (f == ls_[w]) {
+      fs_.erase(fs_.begin() + static_cast<std::ptrdiff_t>(w));
+      ls_.erase(ls_.begin() + static_cast<std::ptrdiff_t>(w));
+      build();
+      return;
+    }
+
+    node up = nodes_.make(*f, w);
+    for (std::size_t i = (w + size()) / 2; i; i /= 2) nodes_.play(tree_[i], up);
+    tree_[0] = up;
+  }
+
+  // First element of the winner's run that doesn't beat the run `other`.
+  I winner_partition_point(std::size_t other) const {
+    const std::size_t w = winner();
+    const auto& o = *fs_[other];
+    const R& r = nodes_.r;
+    if (w < other) {
+      return algo::partition_point_biased(
+          fs_[w], ls_[w], [&](Reference<I> x) { return !r(o, x); });
+    }
+    return algo::partition_point_biased(
+        fs_[w], ls_[w], [&](Reference<I> x) { return r(x, o); });
+  }
+};
+
+}  // namespace detail
+
+// Merges k sorted ranges, given as pairs of iterators, with a loser tree.
+// Every element costs log(k) comparisons, instead of log(k) passes over the
+// data with pairwise merges.
+// When the same run wins merge_k_gallop_after times in a row, everything it
+// has before the runner up is found with partition_point_biased and copied
+// in one go (like merge_biased_first does for two ranges).
+// Stable: equal elements are taken from the earlier range first.
+template <typename Ranges, typename O, typename R>
+// require ForwardRange<Ranges> && ValueType<Ranges> == std::pair<I, I> &&
+//         ForwardIterator<I> && OutputIterator<O, ValueType<I>> &&
+//         WeakStrictOrdering<R, ValueType<I>>
+O merge_k(const Ranges& ranges, O o, R r) {
+  using I = typename ValueType<decltype(std::begin(ranges))>::first_type;
+
+  detail::loser_tree<I, R> tree(ranges, r);
+
+  std::size_t streak = 0;
+  std::size_t last_winner = tree.size();
+
+  // Two runs are done by a regular merge, a tree of 2 doesn't pay for itself.
+  while (tree.size() > 2) {
+    const std::size_t w = tree.winner();
+    streak = w == last_winner ? streak + 1 : 0;
+    last_winner = w;
+
+    I& f = tree.run_f(w);
+    if (streak == merge_k_gallop_after) {
+      streak = 0;
+      I next = tree.winner_partition_point(tree.runner_up());
+      o = algo::copy(f, next, o);
+      f = next;
+    } else {
+      *o = *f;
+      ++o;
+      ++f;
+    }
+    tree.replay(w);
+  }
+
+  if (tree.size() == 2) {
+    return algo::merge(tree.run_f(0), tree.run_l(0), tree.run_f(1),
+                       tree.run_l(1), o, r);
+  }
+  if (tree.size()) o = algo::copy(tree.run_f(0), tree.run_l(0), o);
+  return o;
+}
+
+template <typename Ranges, typename O>
+// require ForwardRange<Ranges> && ValueType<Ranges> == std::pair<I, I> &&
+//         ForwardIterator<I> && OutputIterator<O, ValueType<I>> &&
+//         TotallyOrdered<ValueType<I>>
+O merge_k(const Ranges& ranges, O o) {
+  return algo::merge_k(ranges, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_MERGE_K_H
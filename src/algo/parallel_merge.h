@@ -0,0 +1,114 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_PARALLEL_MERGE_H
+#define ALGO_PARALLEL_MERGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include "algo/half_nonnegative.h"
+#include "algo/merge.h"
+#include "algo/thread_pool.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+namespace detail {
+
+// Merge path: how many elements of the first range are among the first `d`
+// elements of the (stable) merge. The rest comes from the second range.
+// This allows to split a merge into independent pieces of any size.
+template <typename I1, typename I2, typename R>
+// require RandomAccessIterator<I1> && RandomAccessIterator<I2> &&
+//         WeakStrictOrdering<R, ValueType<I1>>
+DifferenceType<I1> merge_path_split(I1 f1, DifferenceType<I1> n1, I2 f2,
+                                    DifferenceType<I1> n2,
+                                    DifferenceType<I1> d, R r) {
+  DifferenceType<I1> lo = std::max(DifferenceType<I1>(0), d - n2);
+  DifferenceType<I1> n = std::min(d, n1) - lo;
+
+  // Ties go to the first range, like in algo::merge.
+  while (n) {
+    DifferenceType<I1> n2h = half_nonnegative(n);
+    DifferenceType<I1> i = lo + n2h;
+    if (!r(f2[d - i - 1], f1[i])) {
+      lo = i + 1;
+      n -= n2h + 1;
+    } else {
+      n = n2h;
+    }
+  }
+  return lo;
+}
+
+// Merges [d_f, d_l) elements of the merge of two ranges to o + d_f.
+// i_f, i_l are merge_path_split for d_f and d_l.
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1> &&
+//         RandomAccessIterator<I2> && RandomAccessIterator<O>
+O merge_path_piece(I1 f1, I2 f2, O o, DifferenceType<I1> d_f,
+                   DifferenceType<I1> d_l, DifferenceType<I1> i_f,
+                   DifferenceType<I1> i_l, R r) {
+  return algo::merge(f1 + i_f, f1 + i_l, f2 + (d_f - i_f), f2 + (d_l - i_l),
+                     o + d_f, r);
+}
+
+}  // namespace detail
+
+// Smaller merges are done on the calling thread.
+inline constexpr std::ptrdiff_t parallel_merge_cutoff = 1 << 14;
+
+// The output is split in equal pieces, one per thread. Where the inputs
+// split for every piece is found with merge path, then each piece is merged
+// with algo::merge on its own.
+template <typename I1, typename I2, typename O, typename R>
+// require Mergeable<I1, I2, O, R> && RandomAccessIterator<I1> &&
+//         RandomAccessIterator<I2> && RandomAccessIterator<O>
+O parallel_merge(thread_pool& pool, I1 f1, I1 l1, I2 f2, I2 l2, O o, R r) {
+  using N = DifferenceType<I1>;
+  const N n1 = l1 - f1;
+  const N n2 = N(l2 - f2);
+  const N n = n1 + n2;
+
+  if (pool.size() == 1 || n <= N(parallel_merge_cutoff)) {
+    return algo::merge(f1, l1, f2, l2, o, r);
+  }
+
+  const std::size_t pieces = pool.size();
+  auto diagonal = [&](std::size_t piece) { return n * N(piece) / N(pieces); };
+
+  pool.for_each_index(pieces, [&](std::size_t piece) {
+    const N d_f = diagonal(piece);
+    const N d_l = diagonal(piece + 1);
+    detail::merge_path_piece(
+        f1, f2, o, d_f, d_l, detail::merge_path_split(f1, n1, f2, n2, d_f, r),
+        detail::merge_path_split(f1, n1, f2, n2, d_l, r), r);
+  });
+
+  return o + n;
+}
+
+template <typename I1, typename I2, typename O>
+// require Mergeable<I1, I2, O, std::less<>> && RandomAccessIterator<I1> &&
+//         RandomAccessIterator<I2> && RandomAccessIterator<O>
+O parallel_merge(thread_pool& pool, I1 f1, I1 l1, I2 f2, I2 l2, O o) {
+  return algo::parallel_merge(pool, f1, l1, f2, l2, o, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_PARALLEL_MERGE_H
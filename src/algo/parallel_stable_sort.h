@@ -0,0 +1,141 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_PARALLEL_STABLE_SORT_H
+#define ALGO_PARALLEL_STABLE_SORT_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "algo/move.h"
+#include "algo/parallel_merge.h"
+#include "algo/stable_sort.h"
+#include "algo/thread_pool.h"
+#include "algo/type_functions.h"
+
+namespace algo {
+
+// Smaller ranges are sorted on the calling thread.
+inline constexpr std::ptrdiff_t parallel_stable_sort_cutoff = 1 << 14;
+
+namespace detail {
+
+// One level of merge sort: merges pairs of neighbouring runs from src to dst.
+// Runs are `width` leaves long. Every merge is split into pieces with
+// merge path, so that all of the threads get work even on the last levels.
+// Splits have to be computed before any of the pieces is merged: merging
+// leaves moved from elements behind.
+template <typename I, typename O, typename Bound, typename R>
+void parallel_merge_level(thread_pool& pool, I src, O dst, std::size_t leaves,
+                          std::size_t width, Bound bound, R r) {
+  using N = DifferenceType<I>;
+
+  const std::size_t pairs = leaves / (2 * width);
+  const std::size_t pieces = (pool.size() + pairs - 1) / pairs;
+
+  // Pair p merges [first(p), middle(p)) and [middle(p), first(p + 1)).
+  auto first = [&](std::size_t pair) { return bound(2 * width * pair); };
+  auto middle = [&](std::size_t pair) {
+    return bound(2 * width * pair + width);
+  };
+  auto diagonal = [&](std::size_t pair, std::size_t piece) {
+    return (first(pair + 1) - first(pair)) * N(piece) / N(pieces);
+  };
+
+  // splits[pair * (pieces + 1) + piece] - where the piece begins.
+  std::vector<N> splits(pairs * (pieces + 1));
+  pool.for_each_index(splits.size(), [&](std::size_t i) {
+    const std::size_t pair = i / (pieces + 1);
+    const N f = first(pair), m = middle(pair), l = first(pair + 1);
+    splits[i] = detail::merge_path_split(src + f, m - f, src + m, l - m,
+                                         diagonal(pair, i % (pieces + 1)), r);
+  });
+
+  pool.for_each_index(pairs * pieces, [&](std::size_t task) {
+    const std::size_t pair = task / pieces;
+    const std::size_t piece = task % pieces;
+    const std::size_t split = pair * (pieces + 1) + piece;
+    const N f = first(pair);
+
+    detail::merge_path_piece(
+        std::make_move_iterator(src + f),
+        std::make_move_iterator(src + middle(pair)), dst + f,
+        diagonal(pair, piece), diagonal(pair, piece + 1), splits[split],
+        splits[split + 1], r);
+  });
+}
+
+}  // namespace detail
+
+// The range is split in a power of 2 number of leaves (at least one per
+// thread) that are sorted in parallel with stable_sort_n_buffered.
+// Then the leaves are merged level by level, going back and forth between
+// the range and the buffer.
+template <typename I, typename R>
+// require RandomAccessIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void parallel_stable_sort(thread_pool& pool, I f, I l, R r) {
+  using N = DifferenceType<I>;
+  const N n = l - f;
+
+  if (pool.size() == 1 || n <= N(parallel_stable_sort_cutoff)) {
+    algo::stable_sort_sufficient_allocation(f, l, r);
+    return;
+  }
+
+  std::size_t leaves = 1;
+  while (leaves < pool.size()) leaves *= 2;
+
+  auto bound = [&](std::size_t leaf) { return n * N(leaf) / N(leaves); };
+
+  std::vector<ValueType<I>> buf(static_cast<std::size_t>(n));
+
+  pool.for_each_index(leaves, [&](std::size_t leaf) {
+    const N leaf_f = bound(leaf);
+    algo::stable_sort_n_buffered(f + leaf_f, bound(leaf + 1) - leaf_f, r,
+                                 buf.begin() + leaf_f);
+  });
+
+  bool in_buf = false;
+  for (std::size_t width = 1; width < leaves; width *= 2) {
+    if (in_buf) {
+      detail::parallel_merge_level(pool, buf.begin(), f, leaves, width, bound,
+                                   r);
+    } else {
+      detail::parallel_merge_level(pool, f, buf.begin(), leaves, width, bound,
+                                   r);
+    }
+    in_buf = !in_buf;
+  }
+
+  if (!in_buf) return;
+
+  pool.for_each_index(leaves, [&](std::size_t leaf) {
+    algo::move(buf.begin() + bound(leaf), buf.begin() + bound(leaf + 1),
+               f + bound(leaf));
+  });
+}
+
+template <typename I>
+// require RandomAccessIterator<I> && TotallyOrdered<ValueType<I>>
+void parallel_stable_sort(thread_pool& pool, I f, I l) {
+  algo::parallel_stable_sort(pool, f, l, std::less<>{});
+}
+
+}  // namespace algo
+
+#endif  // ALGO_PARALLEL_STABLE_SORT_H
@@ -17,14 +17,19 @@
 #ifndef ALGO_STABLE_SORT_H
 #define ALGO_STABLE_SORT_H
 
+#include <algorithm>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "algo/apply_rearrangment.h"
+#include "algo/binary_counter.h"
+#include "algo/binary_search_biased.h"
 #include "algo/half_nonnegative.h"
 #include "algo/merge.h"
+#include "algo/merge_biased.h"
 #include "algo/move.h"
 #include "algo/positions.h"
 #include "algo/quadratic_sort.h"
@@ -132,6 +137,348 @@ void stable_sort_lifting(I f, I l) {
   stable_sort_sufficient_allocation(f, l, std::less<>{});
 }
 
+inline static constexpr int stable_sort_natural_min_run = 32;
+inline static constexpr int stable_sort_natural_biased_ratio = 8;
+
+namespace detail {
+
+template <typename I, typename N>
+struct natural_run {
+  I f;
+  N n;
+  int power;
+};
+
+// Finds the run at the beginning of [f, n).
+// Strictly descending runs are reversed (strictly, so that it's stable).
+// Short runs are extended to min run with insertion sort.
+template <typename I, typename N, typename R>
+// require BidirectionalIterator<I> && Number<N> &&
+//         WeakStrictOrdering<R, ValueType<I>>
+std::pair<I, N> stable_sort_natural_next_run(I f, N n, R r) {
+  I prev = f;
+  I l = std::next(f);
+  N len = 1;
+
+  if (len != n) {
+    if (r(*l, *prev)) {
+      do {
+        prev = l++;
+        ++len;
+      } while (len != n && r(*l, *prev));
+      std::reverse(f, l);
+    } else {
+      do {
+        prev = l++;
+        ++len;
+      } while (len != n && !r(*l, *prev));
+    }
+  }
+
+  const N min_run = std::min(n, N(stable_sort_natural_min_run));
+  if (len < min_run) {
+    l = algo::insertion_sort_n(f, min_run, r);
+    len = min_run;
+  }
+  return {l, len};
+}
+
+// Powersort (Munro, Wild): the depth of the boundary between runs
+// [s1, s2) and [s2, e2) in the balanced merge tree over [0, n).
+// Merging everything on the stack that is deeper keeps merges balanced.
+template <typename N>
+// require Number<N>
+int stable_sort_natural_node_power(N s1, N s2, N e2, N n) {
+  const N two_n = n + n;
+  N a = s1 + s2;
+  N b = s2 + e2;
+
+  int power = 0;
+  while (true) {
+    ++power;
+    if (a >= two_n) {
+      a -= two_n;
+      b -= two_n;
+    } else if (b >= two_n) {
+      break;
+    }
+    a += a;
+    b += b;
+  }
+  return power;
+}
+
+// Merges adjacent sorted [f, m) and [m, l).
+// Only the part that is actually out of order is merged and only the
+// smaller side of it goes to the buffer, so buffer of n / 2 is enough.
+template <typename I, typename B, typename R>
+// require BidirectionalIterator<I> && ForwardIterator<B>
+//         && WeakStrictOrdering<R, ValueType<I>>
+void stable_sort_natural_merge_adjacent(I f, I m, I l, R r, B buf) {
+  if (!r(*m, *std::prev(m))) return;
+
+  f = algo::upper_bound_biased(f, m, *m, r);
+  {
+    const auto& left_max = *std::prev(m);
+    l = algo::partition_point_biased(std::make_reverse_iterator(l),
+                                     std::make_reverse_iterator(m),
+                                     [&](const auto& x) {
+                                       return !r(x, left_max);
+                                     })
+            .base();
+  }
+
+  const auto n1 = std::distance(f, m);
+  const auto n2 = std::distance(m, l);
+
+  using MI = std::move_iterator<I>;
+  using MB = std::move_iterator<B>;
+
+  if (n1 <= n2) {
+    B buf_l = algo::move(f, m, buf);
+    if (n2 / stable_sort_natural_biased_ratio >= n1) {
+      algo::merge_biased_second(MB(buf), MB(buf_l), MI(m), MI(l), f, r);
+    } else {
+      algo::merge(MB(buf), MB(buf_l), MI(m), MI(l), f, r);
+    }
+    return;
+  }
+
+  // Backwards: reversed right from the buffer goes first, so that on equal
+  // elements the right one is placed last.
+  B buf_l = algo::move(m, l, buf);
+
+  using RI = std::reverse_iterator<I>;
+  using RB = std::reverse_iterator<B>;
+  using MRI = std::move_iterator<RI>;
+  using MRB = std::move_iterator<RB>;
+
+  auto reversed_r = [r](const auto& x, const auto& y) { return r(y, x); };
+
+  if (n1 / stable_sort_natural_biased_ratio >= n2) {
+    algo::merge_biased_second(MRB(RB(buf_l)), MRB(RB(buf)), MRI(RI(m)),
+                              MRI(RI(f)), RI(l), reversed_r);
+  } else {
+    algo::merge(MRB(RB(buf_l)), MRB(RB(buf)), MRI(RI(m)), MRI(RI(f)), RI(l),
+                reversed_r);
+  }
+}
+
+}  // namespace detail
+
+// Natural merge sort: uses runs that are already in the input.
+// Sorted or reversed input is O(n), appending a few elements to a sorted
+// range costs about as much as merging them in.
+template <typename I, typename N, typename B, typename R>
+// require BidirectionalIterator<I> && Number<N> && ForwardIterator<B>
+//         && WeakStrictOrdering<R, ValueType<I>>
+I stable_sort_natural_n_buffered(I f, N n, R r, B buf) {
+  if (n == 0) return f;
+
+  using run = detail::natural_run<I, N>;
+  std::vector<run> stack;
+
+  auto merge_top = [&](run& right) {
+    run left = stack.back();
+    stack.pop_back();
+    detail::stable_sort_natural_merge_adjacent(left.f, right.f,
+                                               std::next(right.f, right.n),
+                                               r, buf);
+    right.f = left.f;
+    right.n += left.n;
+  };
+
+  N offset = 0;
+  auto [l, len] = detail::stable_sort_natural_next_run(f, n, r);
+  run cur{f, len, 0};
+  offset = len;
+
+  while (offset != n) {
+    auto [next_l, next_len] =
+        detail::stable_sort_natural_next_run(l, n - offset, r);
+    cur.power = detail::stable_sort_natural_node_power(
+        offset - cur.n, offset, offset + next_len, n);
+
+    while (!stack.empty() && stack.back().power > cur.power) merge_top(cur);
+
+    stack.push_back(cur);
+    cur = run{l, next_len, 0};
+    l = next_l;
+    offset += next_len;
+  }
+
+  while (!stack.empty()) merge_top(cur);
+  return l;
+}
+
+template <typename I, typename N, typename R>
+// require BidirectionalIterator<I> && Number<N>
+//         && WeakStrictOrdering<R, ValueType<I>>
+I stable_sort_natural_n(I f, N n, R r) {
+  std::vector<ValueType<I>> buf(algo::half_nonnegative(n));
+  return algo::stable_sort_natural_n_buffered(f, n, r, buf.begin());
+}
+
+template <typename I, typename N>
+I stable_sort_natural_n(I f, N n) {
+  return stable_sort_natural_n(f, n, std::less<>{});
+}
+
+template <typename I, typename R>
+void stable_sort_natural(I f, I l, R r) {
+  stable_sort_natural_n(f, std::distance(f, l), r);
+}
+
+template <typename I>
+void stable_sort_natural(I f, I l) {
+  stable_sort_natural(f, l, std::less<>{});
+}
+
+inline static constexpr std::size_t stable_sort_bottom_up_block = 1024;
+
+namespace detail {
+
+// Zero for a counter of runs - moved out vector is empty.
+template <typename Run>
+struct empty_run_t {
+  operator Run() const { return {}; }
+
+  friend bool operator==(const Run& x, const empty_run_t&) { return x.empty(); }
+
+  friend bool operator!=(const Run& x, const empty_run_t& y) {
+    return !(x == y);
+  }
+};
+
+// Vectors that are not used at the moment, with their capacity.
+// Merges and blocks take from here, so that after the first batch
+// sorting doesn't allocate.
+template <typename Run>
+struct run_pool {
+  std::vector<Run> spare;
+
+  // Smallest spare vector that fits n, or a new one.
+  Run take(std::size_t n) {
+    auto best = spare.end();
+    for (auto it = spare.begin(); it != spare.end(); ++it) {
+      if (it->capacity() < n) continue;
+      if (best == spare.end() || it->capacity() < best->capacity()) best = it;
+    }
+
+    Run res;
+    if (best == spare.end()) {
+      res.reserve(n);
+      return res;
+    }
+    res = std::move(*best);
+    *best = std::move(spare.back());
+    spare.pop_back();
+    return res;
+  }
+
+  void give(Run x) {
+    if (!x.capacity()) return;
+    x.clear();
+    spare.push_back(std::move(x));
+  }
+};
+
+// Counter digits are older than the carry, so merging older first is stable.
+template <typename Run, typename R>
+struct merge_runs {
+  R r;
+  run_pool<Run>* pool;
+
+  Run operator()(Run&& older, Run&& newer) const {
+    Run res = pool->take(older.size() + newer.size());
+    res.resize(older.size() + newer.size());
+    using MI = std::move_iterator<typename Run::iterator>;
+    algo::merge(MI(older.begin()), MI(older.end()), MI(newer.begin()),
+                MI(newer.end()), res.begin(), r);
+    pool->give(std::move(older));
+    pool->give(std::move(newer));
+    return res;
+  }
+};
+
+}  // namespace detail
+
+// Bottom up merge sort over a binary counter: elements are collected into
+// blocks, each sorted block is added to the counter where merge is the
+// reduction. Doesn't need to know n upfront.
+// The result of `sorted()` belongs to the sorter until the next `push_back`,
+// then its storage is reused. Same for all of the runs: the next batch of
+// the same size doesn't allocate.
+template <typename T, typename R = std::less<>,
+          typename Alloc = std::allocator<T>>
+// require Semiregular<T> && WeakStrictOrdering<R, T>
+class stable_sorter {
+  using run = std::vector<T, Alloc>;
+  using pool = detail::run_pool<run>;
+  using counter =
+      binary_counter<detail::merge_runs<run, R>, run, detail::empty_run_t<run>>;
+
+  R r_;
+  std::size_t block_size_;
+  // Merges keep a pointer to it, so it doesn't move with the sorter.
+  std::unique_ptr<pool> pool_;
+  run block_;
+  run block_buf_;
+  run result_;
+  counter counter_;
+
+  void flush_block() {
+    if (block_.empty()) return;
+    block_buf_.resize(algo::half_nonnegative(block_.size()));
+    algo::stable_sort_n_buffered(block_.begin(), block_.size(), r_,
+                                 block_buf_.begin());
+    counter_.add(std::move(block_));
+    block_ = pool_->take(block_size_);
+  }
+
+ public:
+  explicit stable_sorter(R r = R{},
+                         std::size_t block_size = stable_sort_bottom_up_block)
+      : r_(r),
+        block_size_(block_size),
+        pool_(std::make_unique<pool>()),
+        counter_(detail::merge_runs<run, R>{r, pool_.get()},
+                 detail::empty_run_t<run>{}) {
+    block_.reserve(block_size_);
+  }
+
+  void push_back(T x) {
+    if (result_.capacity()) pool_->give(std::move(result_));
+    block_.push_back(std::move(x));
+    if (block_.size() == block_size_) flush_block();
+  }
+
+  run& sorted() {
+    flush_block();
+    pool_->give(std::move(result_));
+    result_ = counter_.reduce();
+    counter_.clear();
+    // So that giving the result back in push_back doesn't allocate.
+    pool_->spare.reserve(pool_->spare.size() + 1);
+    return result_;
+  }
+};
+
+template <typename I, typename R>
+// require ForwardIterator<I> && WeakStrictOrdering<R, ValueType<I>>
+void stable_sort_bottom_up(I f, I l, R r) {
+  stable_sorter<ValueType<I>, R> sorter(r);
+  for (I it = f; it != l; ++it) sorter.push_back(std::move(*it));
+
+  auto& res = sorter.sorted();
+  algo::move(res.begin(), res.end(), f);
+}
+
+template <typename I>
+void stable_sort_bottom_up(I f, I l) {
+  stable_sort_bottom_up(f, l, std::less<>{});
+}
+
 }  // namespace algo
 
 #endif  // ALGO_STABLE_SORT_H
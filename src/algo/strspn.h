@@ -0,0 +1,76 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STRSPN_H
+#define ALGO_STRSPN_H
+
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+#include "simd/pack.h"
+
+namespace algo {
+namespace _strspn {
+
+// Same page safe iteration as strlen: aligned loads never cross into
+// the page after the terminating zero, as long as the test stops on it.
+template <std::size_t width, typename Test>
+std::size_t first_true(const char* s, Test test) {
+  using pack = simd::pack<std::uint8_t, width>;
+
+  const char* aligned_s = simd::previous_aligned_address<pack>(s);
+  const std::uint32_t offset = static_cast<std::uint32_t>(s - aligned_s);
+
+  auto mmask = simd::ignore_first_n(
+      simd::get_top_bits(test(simd::load<pack>(aligned_s))), offset);
+
+  while (true) {
+    if (const std::optional match = simd::first_true(mmask)) {
+      return static_cast<std::size_t>(aligned_s + *match - s);
+    }
+
+    aligned_s += width;
+    mmask = simd::get_top_bits(test(simd::load<pack>(aligned_s)));
+  }
+}
+
+}  // namespace _strspn
+
+template <std::size_t width>
+std::size_t strcspn(const char* s, const char* reject) {
+  // Including the terminating zero.
+  const simd::byte_set<width> set(reject, reject + std::strlen(reject) + 1);
+  return _strspn::first_true<width>(
+      s, [&](const auto& bytes) { return set.contains(bytes); });
+}
+
+template <std::size_t width>
+std::size_t strspn(const char* s, const char* accept) {
+  const simd::byte_set<width> set(accept, accept + std::strlen(accept));
+  return _strspn::first_true<width>(
+      s, [&](const auto& bytes) { return ~set.contains(bytes); });
+}
+
+template <std::size_t width>
+const char* strpbrk(const char* s, const char* accept) {
+  const char* res = s + algo::strcspn<width>(s, accept);
+  return *res ? res : nullptr;
+}
+
+}  // namespace algo
+
+#endif  // ALGO_STRSPN_H
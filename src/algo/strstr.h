@@ -0,0 +1,95 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_STRSTR_H
+#define ALGO_STRSTR_H
+
+#include <cstddef>
+#include <optional>
+
+#include "algo/strcmp.h"
+#include "algo/strlen.h"
+#include "simd/pack.h"
+
+namespace algo {
+
+// Same idea as unsq::search: look for the first and the last characters
+// of the needle at the same time, verify candidates with strmismatch.
+// Reads for the last character are aligned, so we never cross into a page
+// after the terminating zero. Reads for the first character are behind them.
+template <std::size_t width>
+const char* strstr(const char* s, const char* needle) {
+  using pack = simd::pack<char, width>;
+  using vbool = simd::vbool_t<pack>;
+
+  const auto m = static_cast<std::ptrdiff_t>(algo::strlen<width>(needle));
+  if (!m) return s;
+
+  auto is_match = [&](const char* candidate) {
+    return !*algo::strmismatch<width>(candidate, needle).second;
+  };
+
+  // There have to be at least m - 1 characters to have a last one.
+  for (std::ptrdiff_t i = 0; i != m - 1; ++i) {
+    if (!s[i]) return nullptr;
+  }
+
+  // Before the first aligned address the first character can be before s,
+  // so we go one by one.
+  const char* last_pos = s + m - 1;
+  const char* aligned = simd::previous_aligned_address<pack>(last_pos);
+  if (aligned != last_pos) aligned += width;
+
+  for (; last_pos != aligned; ++last_pos) {
+    if (!*last_pos) return nullptr;
+    const char* candidate = last_pos - (m - 1);
+    if (*candidate == needle[0] && *last_pos == needle[m - 1] &&
+        is_match(candidate)) {
+      return candidate;
+    }
+  }
+
+  const pack zeros = simd::set_zero<pack>();
+  const pack first = simd::set_all<pack>(needle[0]);
+  const pack last = simd::set_all<pack>(needle[m - 1]);
+
+  while (true) {
+    const pack lasts = simd::load<pack>(aligned);
+    const pack firsts = simd::load_unaligned<pack>(aligned - (m - 1));
+
+    const vbool test =
+        simd::equal_pairwise(firsts, first) & simd::equal_pairwise(lasts, last);
+    auto mmask = simd::get_top_bits(test);
+
+    const auto zero_mask = simd::get_top_bits(simd::equal_pairwise(lasts, zeros));
+    if (const std::optional end = simd::first_true(zero_mask)) {
+      mmask = simd::ignore_last_n(mmask, static_cast<std::uint32_t>(width) - *end);
+    }
+
+    while (const std::optional pos = simd::first_true(mmask)) {
+      const char* candidate = aligned + *pos - (m - 1);
+      if (is_match(candidate)) return candidate;
+      mmask = simd::ignore_first_n(mmask, *pos + 1);
+    }
+
+    if (zero_mask) return nullptr;
+    aligned += width;
+  }
+}
+
+}  // namespace algo
+
+#endif  // ALGO_STRSTR_H
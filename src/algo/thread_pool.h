@@ -0,0 +1,124 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ALGO_THREAD_POOL_H
+#define ALGO_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace algo {
+
+// Fixed set of threads that are reused between calls.
+// The calling thread also participates in the work, so thread_pool(1)
+// doesn't start any threads.
+//
+// for_each_index is not reentrant: op should not call back into the pool.
+// op should not throw.
+class thread_pool {
+  std::vector<std::thread> workers_;
+
+  std::mutex submit_;  // one for_each_index at a time.
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::function<void()> job_;
+  std::size_t generation_ = 0;
+  std::size_t running_ = 0;
+  bool stop_ = false;
+
+  void worker_loop() {
+    std::size_t seen = 0;
+    while (true) {
+      std::unique_lock lock{mutex_};
+      wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_) return;
+      seen = generation_;
+
+      lock.unlock();
+      job_();
+      lock.lock();
+
+      if (--running_ == 0) done_.notify_one();
+    }
+  }
+
+ public:
+  static std::size_t default_size() {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  explicit thread_pool(std::size_t n_threads = default_size()) {
+    for (std::size_t i = 1; i < n_threads; ++i) {
+      workers_.emplace_back([this] { worker_loop(); });
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard lock{mutex_};
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+  }
+
+  // Including the calling thread.
+  std::size_t size() const { return workers_.size() + 1; }
+
+  template <typename Op>
+  // require UnaryFunction<Op, std::size_t>
+  void for_each_index(std::size_t n, Op op) {
+    std::atomic<std::size_t> next{0};
+    auto job = [&] {
+      for (std::size_t i = next++; i < n; i = next++) op(i);
+    };
+
+    if (workers_.empty() || n <= 1) {
+      job();
+      return;
+    }
+
+    std::lock_guard submit_lock{submit_};
+    {
+      std::lock_guard lock{mutex_};
+      job_ = std::ref(job);
+      running_ = workers_.size();
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    job();
+
+    std::unique_lock lock{mutex_};
+    done_.wait(lock, [&] { return running_ == 0; });
+    job_ = nullptr;
+  }
+};
+
+}  // namespace algo
+
+#endif  // ALGO_THREAD_POOL_H
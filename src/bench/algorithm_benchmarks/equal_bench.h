@@ -0,0 +1,78 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/bench.h"
+#include "bench_generic/input_generators.h"
+
+namespace bench {
+
+// Driver --------------------------------------------------------
+
+// Two equal ranges: the whole input has to be compared.
+template <typename T>
+struct equal_params {
+  std::vector<T> x;
+  std::vector<T> y;
+};
+
+struct equal_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, equal_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void equal_driver::operator()(Slide slide,
+                                             benchmark::State& state, Alg alg,
+                                             equal_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [x, y] = params;
+
+  for (auto _ : state) {
+    bool res = alg(x.begin(), x.end(), y.begin());
+    benchmark::DoNotOptimize(x);
+    benchmark::DoNotOptimize(y);
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+// Benchmarks ------------------------------------------------------
+
+template <typename... Algorithms>
+struct equal_bench {
+  const char* name() const { return "equal bench"; }
+
+  equal_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {64, 1000, 10'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {100}; }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<char, short, int> types() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t /*percentage*/) const {
+    std::size_t size_in_elements = size / sizeof(T);
+    auto x = bench::random_vector<T>(size_in_elements);
+    auto y = x;
+    return equal_params<T>{std::move(x), std::move(y)};
+  }
+};
+
+}  // namespace bench
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "bench/bench.h"
+#include "bench_generic/input_generators.h"
+
+namespace bench {
+
+// Driver --------------------------------------------------------
+
+template <typename T>
+struct find_first_of_params {
+  std::vector<T> haystack;
+  std::vector<T> set;
+};
+
+struct find_first_of_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg,
+                  find_first_of_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void find_first_of_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    find_first_of_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [haystack, set] = params;
+
+  for (auto _ : state) {
+    auto found = alg(haystack.begin(), haystack.end(), set.begin(), set.end());
+    benchmark::DoNotOptimize(haystack);
+    benchmark::DoNotOptimize(found);
+  }
+}
+
+// Benchmarks ------------------------------------------------------
+
+// Lower case letters, looking for delimiters, the only one is at the end.
+// `percentage` is used as the number of delimiters.
+template <typename... Algorithms>
+struct find_delimiters {
+  const char* name() const { return "find delimiters"; }
+
+  find_first_of_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {40, 1000, 10'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {1, 2, 4, 8, 16}; }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<char> types() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t set_size) const {
+    const std::string delimiters = ",\n\";|\t:!?#$%&*+";
+
+    std::uniform_int_distribution<int> letters('a', 'z');
+    std::vector<T> haystack(size);
+    std::generate(haystack.begin(), haystack.end(), [&] {
+      return static_cast<T>(letters(detail::static_generator()));
+    });
+    haystack.back() = delimiters[set_size - 1];
+
+    std::vector<T> set(delimiters.begin(), delimiters.begin() + set_size);
+    return find_first_of_params<T>{std::move(haystack), std::move(set)};
+  }
+};
+
+}  // namespace bench
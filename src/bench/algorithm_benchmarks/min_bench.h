@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <limits>
+
 #include "bench/bench.h"
 #include "bench_generic/input_generators.h"
 
@@ -48,6 +51,9 @@ BENCH_NOINLINE void min_driver::operator()(Slide slide, benchmark::State& state,
 
 // Benchmarks ------------------------------------------------------
 
+// `percentage` is the position of the (unique) minimum.
+// Matters for the two pass min_value + find.
+
 template <typename... Algorithms>
 struct min_bench {
   const char* name() const { return "min bench"; }
@@ -56,7 +62,7 @@ struct min_bench {
 
   std::vector<std::size_t> sizes() const { return {40, 1000, 10'000}; }
 
-  std::vector<std::size_t> percentage_points() const { return {100}; }
+  std::vector<std::size_t> percentage_points() const { return {5, 50, 95}; }
 
   bench::type_list<Algorithms...> algorithms() const { return {}; }
 
@@ -64,9 +70,15 @@ struct min_bench {
 
   template <typename T>
   auto input(struct bench::type_t<T>, std::size_t size,
-             std::size_t /*percentage*/) const {
+             std::size_t percentage) const {
     std::size_t size_in_elements = size / sizeof(T);
-    return min_params<T>{bench::random_vector<T>(size_in_elements)};
+    auto data = bench::random_vector<T>(size_in_elements);
+
+    constexpr T lowest = std::numeric_limits<T>::min();
+    std::replace(data.begin(), data.end(), lowest, T(lowest + 1));
+    data[size_in_elements * percentage / 100] = lowest;
+
+    return min_params<T>{std::move(data)};
   }
 };
 
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/min_bench.h"
+
+namespace bench {
+
+// Sizes go from fitting in L2 to only fitting in DRAM.
+// The amount of threads is a part of the algorithm.
+template <typename... Algorithms>
+struct parallel_reduce_bench {
+  const char* name() const { return "parallel reduce bench"; }
+
+  min_driver driver() const { return min_driver{}; }
+
+  std::vector<std::size_t> sizes() const {
+    return {1 << 17, 1 << 21, 1 << 24, 1 << 27};
+  }
+
+  std::vector<std::size_t> percentage_points() const { return {100}; }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t /*percentage*/) const {
+    std::size_t size_in_elements = size / sizeof(T);
+    return min_params<T>{bench::random_vector<T>(size_in_elements)};
+  }
+};
+
+}  // namespace bench
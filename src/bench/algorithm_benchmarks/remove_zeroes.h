@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <map>
+#include <memory>
+
 #include "bench/bench.h"
 #include "bench_generic/input_generators.h"
 
@@ -48,6 +51,60 @@ BENCH_NOINLINE void remove_driver::operator()(Slide slide,
   }
 }
 
+// Algorithm writes to a separate buffer, no need to restore the input.
+struct remove_copy_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, remove_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void remove_copy_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    remove_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [data, buffer, x] = params;
+
+  for (auto _ : state) {
+    alg(data.begin(), data.end(), buffer.begin(), x);
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+// Big inputs are shared between algorithms, otherwise they don't fit
+// in memory. Copying to the buffer is not measured: it would be
+// slower than a multithreaded remove.
+template <typename T>
+struct big_remove_params {
+  std::shared_ptr<const std::vector<T>> data;
+  std::shared_ptr<std::vector<T>> buffer;
+  T x;
+};
+
+struct big_remove_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, big_remove_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void big_remove_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    big_remove_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  const auto& data = *params.data;
+  auto& buffer = *params.buffer;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(data.begin(), data.end(), buffer.begin());
+    state.ResumeTiming();
+
+    alg(buffer.begin(), buffer.end(), params.x);
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
 // Benchmarks ------------------------------------------------------
 
 template <typename... Algorithms>
@@ -76,4 +133,58 @@ struct remove_zeroes {
   }
 };
 
+template <typename... Algorithms>
+struct remove_copy_zeroes : remove_zeroes<Algorithms...> {
+  const char* name() const { return "remove copy zeroes"; }
+
+  remove_copy_driver driver() const { return {}; }
+};
+
+// Sizes go way past the caches, thread count is a part of the algorithm.
+template <typename... Algorithms>
+struct remove_zeroes_big {
+  const char* name() const { return "remove zeroes big"; }
+
+  big_remove_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const {
+    return {10'000, 1 << 20, 1 << 24, 1 << 27};
+  }
+
+  std::vector<std::size_t> percentage_points() const { return {5, 50, 95}; }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<char, int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    static std::map<std::pair<std::size_t, std::size_t>,
+                    big_remove_params<T>> cache;
+
+    auto& res = cache[{size, percentage}];
+    if (!res.data) {
+      std::size_t size_in_elements = size / sizeof(T);
+      res.data = std::make_shared<const std::vector<T>>(
+          bench::vector_with_zeroes<T>(size_in_elements,
+                                       static_cast<int>(percentage)));
+      res.buffer = buffer_for<T>(size_in_elements);
+      res.x = 0;
+    }
+    return res;
+  }
+
+ private:
+  template <typename T>
+  static std::shared_ptr<std::vector<T>> buffer_for(std::size_t size) {
+    static std::map<std::size_t, std::shared_ptr<std::vector<T>>> buffers;
+    auto& res = buffers[size];
+    if (!res) res = std::make_shared<std::vector<T>>(size);
+    return res;
+  }
+};
+
 }  // namespace bench
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <random>
+
+#include "bench/bench.h"
+#include "bench_generic/input_generators.h"
+
+namespace bench {
+
+// Driver --------------------------------------------------------
+
+template <typename T>
+struct search_params {
+  std::vector<T> haystack;
+  std::vector<T> needle;
+};
+
+struct search_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, search_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void search_driver::operator()(Slide slide,
+                                              benchmark::State& state, Alg alg,
+                                              search_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [haystack, needle] = params;
+
+  for (auto _ : state) {
+    auto found =
+        alg(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+    benchmark::DoNotOptimize(haystack);
+    benchmark::DoNotOptimize(found);
+  }
+}
+
+// Benchmarks ------------------------------------------------------
+
+// Lower case letters, the needle is at the very end.
+// `percentage` is used as the needle length.
+template <typename... Algorithms>
+struct search_text {
+  const char* name() const { return "search text"; }
+
+  search_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {1000, 10'000, 100'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {2, 8, 32}; }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<char> types() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t needle_size) const {
+    std::uniform_int_distribution<int> letters('a', 'z');
+    auto letter = [&] {
+      return static_cast<T>(letters(detail::static_generator()));
+    };
+
+    std::vector<T> haystack(size);
+    std::generate(haystack.begin(), haystack.end(), letter);
+
+    std::vector<T> needle(haystack.end() - needle_size, haystack.end());
+    return search_params<T>{std::move(haystack), std::move(needle)};
+  }
+};
+
+}  // namespace bench
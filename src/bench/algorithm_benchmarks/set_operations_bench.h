@@ -0,0 +1,144 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <random>
+
+#include "bench/bench.h"
+#include "bench_generic/input_generators.h"
+
+namespace bench {
+
+// Driver --------------------------------------------------------
+
+template <typename T>
+struct set_operation_params {
+  std::vector<T> xs;
+  std::vector<T> ys;
+  std::vector<T> buffer;  // enough for a union
+};
+
+struct set_operation_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, set_operation_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void set_operation_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    set_operation_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [xs, ys, buffer] = params;
+
+  for (auto _ : state) {
+    auto res = alg(xs.begin(), xs.end(), ys.begin(), ys.end(), buffer.begin());
+    benchmark::DoNotOptimize(res);
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+// Input ------------------------------------------------------------
+
+// `ys` is a set of even numbers with random gaps.
+// `xs` has `small_size` elements, `selectivity` percent of them are in `ys`.
+// The rest are odd numbers next to the elements of `ys`.
+template <typename T>
+set_operation_params<T> sets_with_selectivity(std::size_t big_size,
+                                              std::size_t small_size,
+                                              std::size_t selectivity) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<int> step(1, 2);
+  std::uniform_int_distribution<std::size_t> dis(0, 99);
+
+  std::vector<T> ys(big_size);
+  T cur = 0;
+  for (auto& y : ys) {
+    cur += static_cast<T>(2 * step(g));
+    y = cur;
+  }
+
+  std::vector<T> xs;
+  std::sample(ys.begin(), ys.end(), std::back_inserter(xs), small_size, g);
+  for (auto& x : xs) {
+    if (dis(g) >= selectivity) ++x;
+  }
+
+  std::vector<T> buffer(xs.size() + ys.size());
+  return {std::move(xs), std::move(ys), std::move(buffer)};
+}
+
+// Benchmarks ------------------------------------------------------
+
+// Same sizes, percentage is the percentage of matches.
+template <typename... Algorithms>
+struct set_intersection_selectivity {
+  const char* name() const { return "set_intersection selectivity"; }
+
+  set_operation_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {1000, 10'000, 100'000}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {0, 5, 50, 95, 100};
+  }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<int, std::int64_t> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+    return sets_with_selectivity<T>(size_in_elements, size_in_elements,
+                                    percentage);
+  }
+};
+
+// Size is the size of the bigger range, percentage is the size of the
+// smaller one in percents of the bigger one. Half of the elements match.
+template <typename... Algorithms>
+struct set_intersection_size_ratio {
+  const char* name() const { return "set_intersection size ratio"; }
+
+  set_operation_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {100'000}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {1, 2, 3, 5, 10, 25, 100};
+  }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<int, std::int64_t> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+    return sets_with_selectivity<T>(size_in_elements,
+                                    size_in_elements * percentage / 100, 50);
+  }
+};
+
+}  // namespace bench
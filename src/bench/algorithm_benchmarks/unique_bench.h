@@ -0,0 +1,99 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <random>
+
+#include "bench/bench.h"
+#include "bench_generic/input_generators.h"
+
+namespace bench {
+
+// Driver --------------------------------------------------------
+
+template <typename T>
+struct unique_params {
+  std::vector<T> data;
+  std::vector<T> buffer;  // buffer.size() == data.size()
+};
+
+struct unique_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, unique_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_NOINLINE void unique_driver::operator()(Slide slide,
+                                              benchmark::State& state, Alg alg,
+                                              unique_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [data, buffer] = params;
+
+  for (auto _ : state) {
+    std::copy(data.begin(), data.end(), buffer.begin());
+    alg(buffer.begin(), buffer.end());
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+// Input ------------------------------------------------------------
+
+// Sorted, `percentage` of elements are equal to the previous one.
+template <typename T>
+std::vector<T> sorted_with_duplicates(std::size_t size,
+                                      std::size_t percentage) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<std::size_t> dis(0, 99);
+
+  std::vector<T> res(size);
+  std::size_t cur = 0;
+  for (auto& x : res) {
+    if (dis(g) >= percentage) ++cur;
+    x = static_cast<T>(cur);
+  }
+  return res;
+}
+
+// Benchmarks ------------------------------------------------------
+
+template <typename... Algorithms>
+struct unique_sorted {
+  const char* name() const { return "unique sorted"; }
+
+  unique_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {40, 1000, 10'000}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {0, 5, 50, 95};
+  }
+
+  bench::type_list<Algorithms...> algorithms() const { return {}; }
+
+  bench::type_list<short, int, std::int64_t> types() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+    return unique_params<T>{
+        sorted_with_duplicates<T>(size_in_elements, percentage),
+        std::vector<T>(size_in_elements)};
+  }
+};
+
+}  // namespace bench
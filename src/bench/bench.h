@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -54,6 +55,11 @@ struct type_name<int> {
   const char* operator()() const { return "int"; }
 };
 
+template <>
+struct type_name<std::int64_t> {
+  const char* operator()() const { return "int64_t"; }
+};
+
 template <>
 struct type_name<float> {
   const char* operator()() const { return "float"; }
@@ -98,6 +104,24 @@ constexpr auto all_paddings() {
   return do_all_paddings(std::make_index_sequence<kTestAlignmentLimit>{});
 }
 
+template <typename Description, typename = void>
+struct has_paddings : std::false_type {};
+
+template <typename Description>
+struct has_paddings<Description,
+                    std::void_t<decltype(std::declval<Description>().paddings())>>
+    : std::true_type {};
+
+// Benchmarks over big inputs can opt out of trying every padding.
+template <typename Description>
+constexpr auto paddings(const Description& description) {
+  if constexpr (has_paddings<Description>{}) {
+    return description.paddings();
+  } else {
+    return all_paddings();
+  }
+}
+
 template <typename BenchmarkDescription, typename Type, typename Algorithm>
 std::string benchmark_name(BenchmarkDescription description, std::size_t size,
                            Type, Algorithm algorithm, std::size_t percentage,
@@ -122,7 +146,8 @@ template <typename BenchDescription>
 void register_benchmark(BenchDescription description) {
   for (auto size : description.sizes()) {
     _bench::cortesian_product(
-        description.types(), description.algorithms(), _bench::all_paddings(),
+        description.types(), description.algorithms(),
+        _bench::paddings(description),
         [&](auto type, auto algorithm_wrapped, auto padding_wrapped) {
           for (auto percentage : description.percentage_points()) {
             constexpr auto algorighm =
@@ -21,6 +21,7 @@
 #include "algo/binary_search.h"
 #include "algo/merge_biased.h"
 #include "algo/merge.h"
+#include "algo/parallel_merge.h"
 
 namespace bench {
 
@@ -80,6 +81,13 @@ struct algo_merge_biased_second {
   }
 };
 
+struct algo_parallel_merge {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_merge(std::forward<Args>(args)...);
+  }
+};
+
 struct std_lower_bound {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -21,6 +21,8 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <list>
 #include <random>
 #include <set>
 #include <utility>
@@ -151,8 +153,10 @@ std::mt19937& static_generator() {
 }
 
 auto uniform_src(size_t size) {
-  return [ud = std::uniform_int_distribution<>{
-              1, static_cast<int>(size) * 20}]() mutable {
+  // Big sizes would overflow.
+  const int max = static_cast<int>(std::min<size_t>(
+      size * 20, static_cast<size_t>(std::numeric_limits<int>::max())));
+  return [ud = std::uniform_int_distribution<>{1, max}]() mutable {
     return ud(static_generator());
   };
 }
@@ -181,6 +185,13 @@ std::vector<T> sorted_vector(size_t size) {
   return gen(size);
 }
 
+// Same data as sorted_vector, for benchmarks of non random access iterators.
+template <typename T>
+std::list<T> sorted_list(size_t size) {
+  auto v = sorted_vector<T>(size);
+  return std::list<T>(v.begin(), v.end());
+}
+
 template <typename T>
 std::pair<std::vector<T>, std::vector<T>> two_random_vectors(size_t x_size,
                                                              size_t y_size) {
@@ -273,7 +284,7 @@ auto vector_with_zeroes(std::size_t size, int percentage) {
 
       std::vector<T> res = detail::generate_random_vector<T>(size, detail::uniform_src(size));
 
-      int zero_count = static_cast<int>(size) * percentage / 100;
+      auto zero_count = static_cast<std::ptrdiff_t>(size) * percentage / 100;
       std::fill(res.begin(), res.begin() + zero_count, 0);
       std::shuffle(res.begin(), res.end(), detail::static_generator());
 
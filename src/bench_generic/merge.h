@@ -22,6 +22,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "algo/thread_pool.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
@@ -64,6 +65,27 @@ void merge_with_small(benchmark::State& state) {
   merge_common<Alg>(state, x_vec, y_vec, o_vec, std::less<>{});
 }
 
+// Same as merge_with_small, the third argument is the number of threads.
+template <size_t small_size, typename Alg, typename T>
+void parallel_merge_with_small(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const size_t percentage = static_cast<size_t>(state.range(1));
+  const size_t n_threads = static_cast<size_t>(state.range(2));
+
+  const size_t y_size = small_size * percentage / 100;
+  const size_t x_size = size - y_size;
+
+  auto [x_vec, y_vec] = two_sorted_vectors<T>(x_size, y_size);
+  std::vector<T> o_vec(x_size + y_size);
+  algo::thread_pool pool(n_threads);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Alg{}(pool, x_vec.begin(), x_vec.end(),
+                                   y_vec.begin(), y_vec.end(), o_vec.begin(),
+                                   std::less<>{}));
+  }
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_MERGE_H
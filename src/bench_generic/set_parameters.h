@@ -54,6 +54,29 @@ inline void set_5_size_increases(benchmark::internal::Benchmark* b) {
   }
 }
 
+template <size_t total_size, size_t max_threads>
+inline void set_every_10th_percent_and_threads(
+    benchmark::internal::Benchmark* b) {
+  for (int i = 0; i <= 100; i += 10) {
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+      b->Args({static_cast<int>(total_size), i, static_cast<int>(threads)});
+    }
+  }
+}
+
+// Sizes up to max_size, each one for 1, 2, 4 ... max_threads threads.
+template <size_t initial_size, size_t increase, size_t max_size,
+          size_t max_threads>
+inline void set_size_increases_and_threads(
+    benchmark::internal::Benchmark* b) {
+  for (size_t mult = 1; initial_size * mult <= max_size; mult *= increase) {
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+      b->Args({static_cast<int>(initial_size), static_cast<int>(mult),
+               static_cast<int>(threads)});
+    }
+  }
+}
+
 template <size_t total_size>
 inline void set_every_int_size(benchmark::internal::Benchmark* b) {
   b->Args({static_cast<int>(total_size), 8});
@@ -23,6 +23,7 @@
 #include <benchmark/benchmark.h>
 #include <boost/multiprecision/cpp_int.hpp>
 
+#include "algo/thread_pool.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
@@ -49,6 +50,16 @@ void sort_vec(benchmark::State& state) {
   sort_common<Alg>(state, vec, std::less<>{});
 }
 
+template <typename Alg, typename T>
+void sort_nth_permutation_vec(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(0));
+  const int percentage = static_cast<int>(state.range(1));
+
+  auto vec = nth_vector_permutation<T>(size, percentage);
+
+  sort_common<Alg>(state, vec, std::less<>{});
+}
+
 template <typename Alg, typename T>
 void sort_vec_size(benchmark::State& state) {
   const size_t initial_size = static_cast<size_t>(state.range(0));
@@ -59,6 +70,22 @@ void sort_vec_size(benchmark::State& state) {
   sort_common<Alg>(state, vec, std::less<>{});
 }
 
+template <typename Alg, typename T>
+void parallel_sort_vec_size(benchmark::State& state) {
+  const size_t initial_size = static_cast<size_t>(state.range(0));
+  const size_t multiplier = static_cast<size_t>(state.range(1));
+  const size_t n_threads = static_cast<size_t>(state.range(2));
+
+  auto vec = random_vector<T>(initial_size * multiplier);
+  algo::thread_pool pool(n_threads);
+
+  for (auto _ : state) {
+    auto copy = vec;
+    Alg{}(pool, copy.begin(), copy.end(), std::less<>{});
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
 }  // namespace bench
 
 #endif  // BENCH_GENERIC_SORT_H
@@ -17,6 +17,7 @@
 #ifndef BENCH_GENERIC_SORT_FUNCTION_OBJECTS_H
 #define BENCH_GENERIC_SORT_FUNCTION_OBJECTS_H
 
+#include "algo/parallel_stable_sort.h"
 #include "algo/stable_sort.h"
 
 namespace bench {
@@ -36,6 +37,20 @@ struct algo_stable_sort_sufficient_allocation_std_merge {
   }
 };
 
+struct algo_stable_sort_natural {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::stable_sort_natural(std::forward<Args>(args)...);
+  }
+};
+
+struct algo_stable_sort_bottom_up {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::stable_sort_bottom_up(std::forward<Args>(args)...);
+  }
+};
+
 struct algo_stable_sort_lifting {
   template <typename... Args>
   auto operator()(Args&&... args) const {
@@ -43,6 +58,13 @@ struct algo_stable_sort_lifting {
   }
 };
 
+struct algo_parallel_stable_sort {
+  template <typename... Args>
+  auto operator()(Args&&... args) const {
+    return algo::parallel_stable_sort(std::forward<Args>(args)...);
+  }
+};
+
 struct baseline_sort {
   template <typename... Args>
   void operator()(Args&&...) const {}
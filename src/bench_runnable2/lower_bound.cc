@@ -15,14 +15,25 @@
  */
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "bench/bench.h"
 #include "bench_generic/declaration.h"
 #include "bench_generic/input_generators.h"
 
+#include "algo/binary_search.h"
 #include "algo/binary_search_biased.h"
+#include "algo/eytzinger.h"
+#include "algo/finger_search.h"
+#include "unsq/lower_bound.h"
+#include "unsq/static_btree.h"
 
 namespace {
 
@@ -52,6 +63,142 @@ BENCH_DECL_ATTRIBUTES void lower_bound_driver::operator()(
   }
 }
 
+// Position of the lower bound in a list, the size is known.
+template <typename T>
+struct lower_bound_rank_params {
+  std::list<T> data;  // Should be sorted
+  T x;
+};
+
+struct lower_bound_rank_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg,
+                  lower_bound_rank_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void lower_bound_rank_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    lower_bound_rank_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [data, x] = params;
+  const auto n = static_cast<std::ptrdiff_t>(data.size());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(alg(data.begin(), n, x));
+  }
+}
+
+// Every next query depends on the result of the previous one,
+// so this measures latency of a search rather than throughput.
+template <typename T>
+struct lower_bound_queries_params {
+  std::vector<T> data;     // Should be sorted
+  std::vector<T> queries;  // Size is a power of 2
+};
+
+struct lower_bound_dependent_queries_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg,
+                  lower_bound_queries_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void lower_bound_dependent_queries_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    lower_bound_queries_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [data, queries] = params;
+  const std::size_t mask = queries.size() - 1;
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    auto found = alg(data.begin(), data.end(), queries[i]);
+    benchmark::DoNotOptimize(found);
+    i = (i + 1 + static_cast<std::size_t>(found == data.end())) & mask;
+  }
+}
+
+// All of the keys are looked up in every iteration.
+template <typename T>
+struct lower_bound_batch_params {
+  std::shared_ptr<const std::vector<T>> data;  // Shared between benchmarks
+  std::vector<T> keys;
+  std::vector<typename std::vector<T>::const_iterator> found;
+};
+
+struct lower_bound_batch_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg,
+                  lower_bound_batch_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void lower_bound_batch_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    lower_bound_batch_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [data, keys, found] = params;
+
+  for (auto _ : state) {
+    alg(data->begin(), data->end(), keys.begin(), keys.end(), found.begin());
+    benchmark::DoNotOptimize(found);
+  }
+}
+
+// Same data in every layout. Built once and shared between benchmarks.
+template <typename T>
+struct static_layouts {
+  std::vector<T> sorted;
+  algo::eytzinger<T> eytzinger;
+  unsq::static_btree<T, 32 / sizeof(T)> btree_256;
+#ifdef __AVX512BW__
+  unsq::static_btree<T, 64 / sizeof(T)> btree_512;
+#endif
+
+  explicit static_layouts(std::vector<T> data)
+      : sorted(std::move(data)),
+        eytzinger(sorted.begin(), sorted.end()),
+        btree_256(sorted.begin(), sorted.end())
+#ifdef __AVX512BW__
+        ,
+        btree_512(sorted.begin(), sorted.end())
+#endif
+  {
+  }
+};
+
+template <typename T>
+struct static_layout_params {
+  std::shared_ptr<const static_layouts<T>> layouts;
+  std::vector<T> keys;
+};
+
+// Independent lookups of all keys, sums the results.
+struct static_layout_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg,
+                  static_layout_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void static_layout_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    static_layout_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  auto& [layouts, keys] = params;
+
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const T& key : keys) sum += alg(*layouts, key);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
 // Algorithms -----------------------------------------------------
 
 struct algo_lower_bound_linear {
@@ -81,6 +228,165 @@ struct std_lower_bound {
   }
 };
 
+template <std::size_t byte_width>
+struct unsq_lower_bound {
+  const char* name() const {
+    static const std::string res =
+        "unsq::lower_bound<" + std::to_string(byte_width * 8) + ">";
+    return res.c_str();
+  }
+
+  template <typename I, typename T>
+  I operator()(I f, I l, const T& v) const {
+    return unsq::lower_bound<byte_width / sizeof(unsq::ValueType<I>)>(f, l, v);
+  }
+};
+
+struct algo_lower_bound_n_and_distance {
+  const char* name() const { return "algo::lower_bound_n + std::distance"; }
+
+  template <typename I, typename T>
+  algo::DifferenceType<I> operator()(I f, algo::DifferenceType<I> n,
+                                     const T& v) const {
+    return std::distance(f, algo::lower_bound_n(f, n, v));
+  }
+};
+
+struct algo_lower_bound_n_counting {
+  const char* name() const { return "algo::lower_bound_n_counting"; }
+
+  template <typename I, typename T>
+  algo::DifferenceType<I> operator()(I f, algo::DifferenceType<I> n,
+                                     const T& v) const {
+    return algo::lower_bound_n_counting(f, n, v).second;
+  }
+};
+
+// Two independent searches.
+struct std_lower_and_upper_bound {
+  const char* name() const { return "std::lower_bound + std::upper_bound"; }
+
+  template <typename I, typename T>
+  std::pair<I, I> operator()(I f, I l, const T& v) const {
+    return {std::lower_bound(f, l, v), std::upper_bound(f, l, v)};
+  }
+};
+
+struct std_equal_range {
+  const char* name() const { return "std::equal_range"; }
+
+  template <typename I, typename T>
+  std::pair<I, I> operator()(I f, I l, const T& v) const {
+    return std::equal_range(f, l, v);
+  }
+};
+
+struct algo_equal_range {
+  const char* name() const { return "algo::equal_range"; }
+
+  template <typename I, typename T>
+  std::pair<I, I> operator()(I f, I l, const T& v) const {
+    return algo::equal_range(f, l, v);
+  }
+};
+
+struct algo_equal_range_biased {
+  const char* name() const { return "algo::equal_range_biased"; }
+
+  template <typename I, typename T>
+  std::pair<I, I> operator()(I f, I l, const T& v) const {
+    return algo::equal_range_biased(f, l, v);
+  }
+};
+
+// Looks up the keys one by one.
+template <typename Alg>
+struct one_by_one {
+  const char* name() const {
+    static const std::string res = std::string(Alg{}.name()) + " one by one";
+    return res.c_str();
+  }
+
+  template <typename I, typename KeysI, typename O>
+  O operator()(I f, I l, KeysI keys_f, KeysI keys_l, O o) const {
+    return std::transform(keys_f, keys_l, o,
+                          [&](const auto& key) { return Alg{}(f, l, key); });
+  }
+};
+
+struct algo_lower_bound_batch {
+  const char* name() const { return "algo::lower_bound_batch"; }
+
+  template <typename I, typename KeysI, typename O>
+  O operator()(I f, I l, KeysI keys_f, KeysI keys_l, O o) const {
+    return algo::lower_bound_batch(f, l, keys_f, keys_l, o);
+  }
+};
+
+// Threads the previous result back in as a hint.
+struct algo_lower_bound_hinted_by_hand {
+  const char* name() const { return "algo::lower_bound_hinted by hand"; }
+
+  template <typename I, typename KeysI, typename O>
+  O operator()(I f, I l, KeysI keys_f, KeysI keys_l, O o) const {
+    I hint = f;
+    for (; keys_f != keys_l; ++keys_f) {
+      hint = algo::lower_bound_hinted(f, hint, l, *keys_f);
+      *o++ = hint;
+    }
+    return o;
+  }
+};
+
+struct algo_finger_search {
+  const char* name() const { return "algo::finger_search"; }
+
+  template <typename I, typename KeysI, typename O>
+  O operator()(I f, I l, KeysI keys_f, KeysI keys_l, O o) const {
+    return algo::finger_search<I>(f, l).seek_all(keys_f, keys_l, o);
+  }
+};
+
+struct std_lower_bound_sorted {
+  const char* name() const { return "std::lower_bound"; }
+
+  template <typename T>
+  std::size_t operator()(const static_layouts<T>& layouts, const T& v) const {
+    const auto& sorted = layouts.sorted;
+    return static_cast<std::size_t>(
+        std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+  }
+};
+
+struct algo_eytzinger {
+  const char* name() const { return "algo::eytzinger"; }
+
+  template <typename T>
+  std::size_t operator()(const static_layouts<T>& layouts, const T& v) const {
+    return layouts.eytzinger.lower_bound(v);
+  }
+};
+
+struct unsq_static_btree_256 {
+  const char* name() const { return "unsq::static_btree<256>"; }
+
+  template <typename T>
+  std::size_t operator()(const static_layouts<T>& layouts, const T& v) const {
+    return layouts.btree_256.lower_bound(v);
+  }
+};
+
+#ifdef __AVX512BW__
+struct unsq_static_btree_512 {
+  const char* name() const { return "unsq::static_btree<512>"; }
+
+  template <typename T>
+  std::size_t operator()(const static_layouts<T>& layouts, const T& v) const {
+    return layouts.btree_512.lower_bound(v);
+  }
+};
+#endif
+
 // Benchmarks ------------------------------------------------------
 
 struct lower_bound_common {
@@ -91,14 +397,24 @@ struct lower_bound_common {
   std::vector<std::size_t> sizes() const { return {4000}; }
 
   std::vector<std::size_t> percentage_points() const {
-    return {5, 20, 50, 80, 95};
+    return {0, 5, 20, 35, 50, 65, 80, 95, 100};
   }
 
+#ifdef __AVX512BW__
   bench::type_list<algo_lower_bound_linear, algo_lower_bound_biased,
-                   std_lower_bound>
+                   std_lower_bound, unsq_lower_bound<16>,
+                   unsq_lower_bound<32>, unsq_lower_bound<64>>
   algorithms() const {
     return {};
   }
+#else
+  bench::type_list<algo_lower_bound_linear, algo_lower_bound_biased,
+                   std_lower_bound, unsq_lower_bound<16>,
+                   unsq_lower_bound<32>>
+  algorithms() const {
+    return {};
+  }
+#endif
 
   bench::type_list<int, float> types() const { return {}; }
 };
@@ -133,6 +449,261 @@ struct lower_bound_first_5_percent : lower_bound_common {
   }
 };
 
+// Every value is repeated 16 times.
+struct equal_range_duplicates {
+  const char* name() const { return "equal range duplicates"; }
+
+  lower_bound_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {4000, 400'000}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {0, 5, 20, 50, 80, 100};
+  }
+
+  bench::type_list<std_lower_and_upper_bound, std_equal_range,
+                   algo_equal_range, algo_equal_range_biased>
+  algorithms() const {
+    return {};
+  }
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    std::vector<T> input(size_in_elements);
+    for (std::size_t i = 0; i != size_in_elements; ++i) {
+      input[i] = static_cast<T>(i / 16);
+    }
+    T value = input[(size_in_elements - 1) * percentage / 100];
+
+    return lower_bound_params<T>{input, value};
+  }
+};
+
+// Rank of an element in a std::list, where std::distance is linear.
+struct lower_bound_rank_list {
+  const char* name() const { return "lower bound rank list"; }
+
+  lower_bound_rank_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {4000, 400'000}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {0, 5, 20, 50, 80, 95, 100};
+  }
+
+  bench::type_list<algo_lower_bound_n_and_distance,
+                   algo_lower_bound_n_counting>
+  algorithms() const {
+    return {};
+  }
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    auto input = bench::sorted_list<T>(size_in_elements);
+    T value = *std::next(input.begin(),
+                         (size_in_elements - 1) * percentage / 100);
+
+    return lower_bound_rank_params<T>{std::move(input), value};
+  }
+};
+
+// Queries are random elements from the first `percentage` of the range.
+struct lower_bound_dependent_queries : lower_bound_common {
+  const char* name() const { return "lower bound dependent queries"; }
+
+  lower_bound_dependent_queries_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {4000, 4'000'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {5, 50, 100}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    auto input = bench::sorted_vector<T>(size_in_elements);
+    const std::size_t prefix =
+        std::max<std::size_t>(1, size_in_elements * percentage / 100);
+
+    static std::mt19937 g;
+    std::uniform_int_distribution<std::size_t> dis(0, prefix - 1);
+
+    std::vector<T> queries(1024);
+    for (auto& q : queries) q = input[dis(g)];
+
+    return lower_bound_queries_params<T>{input, queries};
+  }
+};
+
+// The range is a lot bigger than the last level cache.
+struct lower_bound_batch {
+  const char* name() const { return "lower bound batch"; }
+
+  lower_bound_batch_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {1'000'000'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {100}; }
+
+#ifdef __AVX512BW__
+  bench::type_list<one_by_one<std_lower_bound>,
+                   one_by_one<unsq_lower_bound<32>>,
+                   one_by_one<unsq_lower_bound<64>>, algo_lower_bound_batch>
+  algorithms() const {
+    return {};
+  }
+#else
+  bench::type_list<one_by_one<std_lower_bound>,
+                   one_by_one<unsq_lower_bound<32>>, algo_lower_bound_batch>
+  algorithms() const {
+    return {};
+  }
+#endif
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t /*percentage*/) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    // Sorting random numbers of this size takes too long.
+    static std::shared_ptr<const std::vector<T>> data;
+    if (!data || data->size() != size_in_elements) {
+      auto generated = std::make_shared<std::vector<T>>(size_in_elements);
+      for (std::size_t i = 0; i != size_in_elements; ++i) {
+        (*generated)[i] = static_cast<T>(i * 2);
+      }
+      data = std::move(generated);
+    }
+
+    static std::mt19937 g;
+    std::uniform_int_distribution<std::size_t> dis(0, size_in_elements * 2);
+
+    std::vector<T> keys(4096);
+    for (auto& key : keys) key = static_cast<T>(dis(g));
+
+    return lower_bound_batch_params<T>{
+        data, keys,
+        std::vector<typename std::vector<T>::const_iterator>(keys.size())};
+  }
+};
+
+// Sorted keys, spread over the first `percentage` of the range.
+struct lower_bound_monotone_queries {
+  const char* name() const { return "lower bound monotone queries"; }
+
+  lower_bound_batch_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {400'000, 40'000'000}; }
+
+  std::vector<std::size_t> percentage_points() const { return {1, 10, 100}; }
+
+  bench::type_list<one_by_one<std_lower_bound>, algo_lower_bound_batch,
+                   algo_lower_bound_hinted_by_hand, algo_finger_search>
+  algorithms() const {
+    return {};
+  }
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t percentage) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    static std::shared_ptr<const std::vector<T>> data;
+    if (!data || data->size() != size_in_elements) {
+      data = std::make_shared<const std::vector<T>>(
+          bench::sorted_vector<T>(size_in_elements));
+    }
+
+    const std::size_t prefix = size_in_elements * percentage / 100;
+
+    static std::mt19937 g;
+    std::uniform_int_distribution<std::size_t> dis(0, prefix - 1);
+
+    std::vector<T> keys(4096);
+    for (auto& key : keys) key = (*data)[dis(g)];
+    std::sort(keys.begin(), keys.end());
+
+    return lower_bound_batch_params<T>{
+        data, keys,
+        std::vector<typename std::vector<T>::const_iterator>(keys.size())};
+  }
+};
+
+// Queries are random elements of the range.
+struct lower_bound_static_layouts {
+  const char* name() const { return "lower bound static layouts"; }
+
+  static_layout_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const {
+    return {4000, 400'000, 40'000'000};
+  }
+
+  std::vector<std::size_t> percentage_points() const { return {100}; }
+
+#ifdef __AVX512BW__
+  bench::type_list<std_lower_bound_sorted, algo_eytzinger,
+                   unsq_static_btree_256, unsq_static_btree_512>
+  algorithms() const {
+    return {};
+  }
+#else
+  bench::type_list<std_lower_bound_sorted, algo_eytzinger,
+                   unsq_static_btree_256>
+  algorithms() const {
+    return {};
+  }
+#endif
+
+  bench::type_list<int> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t size,
+             std::size_t /*percentage*/) const {
+    std::size_t size_in_elements = size / sizeof(T);
+
+    static std::shared_ptr<const static_layouts<T>> layouts;
+    if (!layouts || layouts->sorted.size() != size_in_elements) {
+      layouts = std::make_shared<const static_layouts<T>>(
+          bench::sorted_vector<T>(size_in_elements));
+    }
+
+    static std::mt19937 g;
+    std::uniform_int_distribution<std::size_t> dis(0, size_in_elements - 1);
+
+    std::vector<T> keys(1024);
+    for (auto& key : keys) key = layouts->sorted[dis(g)];
+
+    return static_layout_params<T>{layouts, keys};
+  }
+};
 
 }  // namespace
 
@@ -142,6 +713,12 @@ int main(int argc, char** argv) {
 
   bench::register_benchmark(lower_bound_whole_range{});
   bench::register_benchmark(lower_bound_first_5_percent{});
+  bench::register_benchmark(equal_range_duplicates{});
+  bench::register_benchmark(lower_bound_rank_list{});
+  bench::register_benchmark(lower_bound_dependent_queries{});
+  bench::register_benchmark(lower_bound_batch{});
+  bench::register_benchmark(lower_bound_monotone_queries{});
+  bench::register_benchmark(lower_bound_static_layouts{});
 
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bench/bench.h"
+#include "bench_generic/declaration.h"
+#include "bench_generic/fake_url.h"
+
+#include "algo/merge.h"
+#include "algo/merge_k.h"
+
+namespace bench {
+
+template <>
+struct type_name<fake_url> {
+  const char* operator()() const { return "fake_url"; }
+};
+
+}  // namespace bench
+
+namespace {
+
+// Driver ---------------------------------------------------------
+
+template <typename T>
+struct merge_k_params {
+  std::vector<std::vector<T>> runs;  // Every one is sorted
+  std::vector<T> out;
+  std::vector<T> buffer;  // Same size as out
+};
+
+struct merge_k_driver {
+  template <typename Slide, typename Alg, typename T>
+  void operator()(Slide, benchmark::State&, Alg, merge_k_params<T>&) const;
+};
+
+template <typename Slide, typename Alg, typename T>
+BENCH_DECL_ATTRIBUTES void merge_k_driver::operator()(
+    Slide slide, benchmark::State& state, Alg alg,
+    merge_k_params<T>& params) const {
+  bench::noop_slide(slide);
+
+  for (auto _ : state) {
+    alg(params.runs, params.out, params.buffer);
+    benchmark::DoNotOptimize(params.out);
+  }
+}
+
+// Algorithms -----------------------------------------------------
+
+struct algo_merge_k {
+  const char* name() const { return "algo::merge_k"; }
+
+  template <typename T>
+  void operator()(const std::vector<std::vector<T>>& runs, std::vector<T>& out,
+                  std::vector<T>&) const {
+    using I = typename std::vector<T>::const_iterator;
+    std::vector<std::pair<I, I>> ranges;
+    ranges.reserve(runs.size());
+    for (const auto& run : runs) ranges.emplace_back(run.begin(), run.end());
+
+    algo::merge_k(ranges, out.begin(), std::less<>{});
+  }
+};
+
+// Balanced tree of algo::merge: neighbouring runs are merged until one is
+// left, going back and forth between the output and the buffer.
+struct algo_merge_pairwise {
+  const char* name() const { return "algo::merge pairwise"; }
+
+  template <typename T>
+  void operator()(const std::vector<std::vector<T>>& runs, std::vector<T>& out,
+                  std::vector<T>& buffer) const {
+    // Log levels are odd - start in the buffer, to finish in out.
+    std::size_t levels = 0;
+    for (std::size_t k = 1; k < runs.size(); k *= 2) ++levels;
+
+    std::vector<T>* src = levels % 2 ? &buffer : &out;
+    std::vector<T>* dst = levels % 2 ? &out : &buffer;
+
+    std::vector<std::size_t> bounds{0};
+    for (const auto& run : runs) {
+      std::copy(run.begin(), run.end(), src->begin() + bounds.back());
+      bounds.push_back(bounds.back() + run.size());
+    }
+
+    while (bounds.size() > 2) {
+      std::vector<std::size_t> next_bounds{0};
+      for (std::size_t i = 0; i + 1 < bounds.size(); i += 2) {
+        const std::size_t f = bounds[i];
+        const std::size_t m = bounds[i + 1];
+        const std::size_t l = i + 2 < bounds.size() ? bounds[i + 2] : m;
+        algo::merge(src->begin() + f, src->begin() + m, src->begin() + m,
+                    src->begin() + l, dst->begin() + f, std::less<>{});
+        next_bounds.push_back(l);
+      }
+      bounds = std::move(next_bounds);
+      std::swap(src, dst);
+    }
+  }
+};
+
+// Benchmarks ------------------------------------------------------
+
+// Size is the number of runs. Percentage is how much of the data is in the
+// first run, the rest is split equally (0 - all runs are the same size).
+// All runs take values from the same range, so the bigger the first run is
+// the longer are the stretches where only it wins.
+struct merge_k_runs {
+  const char* name() const { return "merge k runs"; }
+
+  merge_k_driver driver() const { return {}; }
+
+  std::vector<std::size_t> sizes() const { return {2, 8, 16, 64}; }
+
+  std::vector<std::size_t> percentage_points() const {
+    return {0, 50, 90, 99};
+  }
+
+  bench::type_list<algo_merge_pairwise, algo_merge_k> algorithms() const {
+    return {};
+  }
+
+  // fake_url - heads in the tree are stored by pointer.
+  bench::type_list<int, bench::fake_url> types() const { return {}; }
+
+  bench::type_list<bench::index_c<0>> paddings() const { return {}; }
+
+  template <typename T>
+  auto input(struct bench::type_t<T>, std::size_t k,
+             std::size_t percentage) const {
+    // All inputs are kept in memory, 1M of fake_url for every one is too much.
+    constexpr std::size_t total = std::is_same_v<T, int> ? 1 << 20 : 1 << 18;
+
+    const std::size_t first = percentage ? total * percentage / 100 : total / k;
+    const std::size_t others = (total - first) / (k - 1);
+
+    static std::mt19937 g;
+    std::uniform_int_distribution<int> dis(0, static_cast<int>(total));
+
+    merge_k_params<T> res;
+    for (std::size_t i = 0; i != k; ++i) {
+      std::vector<T> run(i ? others : first);
+      for (auto& x : run) x = T(dis(g));
+      std::sort(run.begin(), run.end());
+      res.out.resize(res.out.size() + run.size());
+      res.runs.push_back(std::move(run));
+    }
+    res.buffer.resize(res.out.size());
+    return res;
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  bench::register_benchmark(merge_k_runs{});
+
+  benchmark::RunSpecifiedBenchmarks();
+}
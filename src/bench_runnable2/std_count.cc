@@ -0,0 +1,36 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/count_zeroes.h"
+
+#include <algorithm>
+
+namespace {
+
+struct std_count {
+  const char* name() const { return "std::count"; }
+
+  template <typename I, typename T>
+  auto operator()(I f, I l, const T& x) const {
+    return std::count(f, l, x);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench::bench_main<bench::count_zeroes<std_count>>(argc, argv);
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/find_delimiters.h"
+
+#include <algorithm>
+
+namespace {
+
+struct std_find_first_of {
+  const char* name() const { return "std::find_first_of"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 set_f, I2 set_l) const {
+    return std::find_first_of(f, l, set_f, set_l);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench::bench_main<bench::find_delimiters<std_find_first_of>>(argc, argv);
+}
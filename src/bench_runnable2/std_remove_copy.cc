@@ -0,0 +1,36 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/remove_zeroes.h"
+
+#include <algorithm>
+
+namespace {
+
+struct std_remove_copy {
+  const char* name() const { return "std::remove_copy"; }
+
+  template <typename I, typename O, typename T>
+  O operator()(I f, I l, O o, const T& v) const {
+    return std::remove_copy(f, l, o, v);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench::bench_main<bench::remove_copy_zeroes<std_remove_copy>>(argc, argv);
+}
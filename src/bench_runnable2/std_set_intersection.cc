@@ -0,0 +1,39 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bench/algorithm_benchmarks/set_operations_bench.h"
+
+#include <algorithm>
+
+namespace {
+
+struct std_set_intersection {
+  const char* name() const { return "std::set_intersection"; }
+
+  template <typename I, typename O>
+  O operator()(I f1, I l1, I f2, I l2, O o) const {
+    return std::set_intersection(f1, l1, f2, l2, o);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench::bench_main<
+      bench::set_intersection_selectivity<std_set_intersection>,
+      bench::set_intersection_size_ratio<std_set_intersection>>(argc, argv);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/count_zeroes.h"
+
+#include "unsq/count.h"
+
+namespace {
+
+struct unsq_count_128 {
+  const char* name() const { return "unsq::count<128>"; }
+
+  template <typename I, typename T>
+  auto operator()(I f, I l, const T& x) const {
+    return unsq::count<16 / sizeof(unsq::ValueType<I>)>(f, l, x);
+  }
+};
+
+struct unsq_count_256 {
+  const char* name() const { return "unsq::count<256>"; }
+
+  template <typename I, typename T>
+  auto operator()(I f, I l, const T& x) const {
+    return unsq::count<32 / sizeof(unsq::ValueType<I>)>(f, l, x);
+  }
+};
+
+struct unsq_count_512 {
+  const char* name() const { return "unsq::count<512>"; }
+
+  template <typename I, typename T>
+  auto operator()(I f, I l, const T& x) const {
+    return unsq::count<64 / sizeof(unsq::ValueType<I>)>(f, l, x);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<
+      bench::count_zeroes<unsq_count_128, unsq_count_256, unsq_count_512>>(
+      argc, argv);
+#else
+  bench::bench_main<bench::count_zeroes<unsq_count_128, unsq_count_256>>(
+      argc, argv);
+#endif
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/equal_bench.h"
+
+#include "unsq/mismatch.h"
+
+namespace {
+
+struct unsq_equal_128 {
+  const char* name() const { return "unsq::equal<128>"; }
+
+  template <typename I1, typename I2>
+  bool operator()(I1 f1, I1 l1, I2 f2) const {
+    return unsq::equal<16 / sizeof(unsq::ValueType<I1>)>(f1, l1, f2);
+  }
+};
+
+struct unsq_equal_256 {
+  const char* name() const { return "unsq::equal<256>"; }
+
+  template <typename I1, typename I2>
+  bool operator()(I1 f1, I1 l1, I2 f2) const {
+    return unsq::equal<32 / sizeof(unsq::ValueType<I1>)>(f1, l1, f2);
+  }
+};
+
+struct unsq_equal_512 {
+  const char* name() const { return "unsq::equal<512>"; }
+
+  template <typename I1, typename I2>
+  bool operator()(I1 f1, I1 l1, I2 f2) const {
+    return unsq::equal<64 / sizeof(unsq::ValueType<I1>)>(f1, l1, f2);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<
+      bench::equal_bench<unsq_equal_128, unsq_equal_256, unsq_equal_512>>(
+      argc, argv);
+#else
+  bench::bench_main<bench::equal_bench<unsq_equal_128, unsq_equal_256>>(
+      argc, argv);
+#endif
+}
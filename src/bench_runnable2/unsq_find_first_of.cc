@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/find_delimiters.h"
+
+#include "unsq/find_first_of.h"
+
+namespace {
+
+struct unsq_find_first_of_128 {
+  const char* name() const { return "unsq::find_first_of<128>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 set_f, I2 set_l) const {
+    return unsq::find_first_of<16>(f, l, set_f, set_l);
+  }
+};
+
+struct unsq_find_first_of_256 {
+  const char* name() const { return "unsq::find_first_of<256>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 set_f, I2 set_l) const {
+    return unsq::find_first_of<32>(f, l, set_f, set_l);
+  }
+};
+
+struct unsq_find_first_of_512 {
+  const char* name() const { return "unsq::find_first_of<512>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 set_f, I2 set_l) const {
+    return unsq::find_first_of<64>(f, l, set_f, set_l);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::find_delimiters<unsq_find_first_of_128,
+                                           unsq_find_first_of_256,
+                                           unsq_find_first_of_512>>(argc, argv);
+#else
+  bench::bench_main<bench::find_delimiters<unsq_find_first_of_128,
+                                           unsq_find_first_of_256>>(argc, argv);
+#endif
+}
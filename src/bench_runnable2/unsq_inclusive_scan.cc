@@ -0,0 +1,62 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/scan_bench.h"
+
+#include "unsq/scan.h"
+
+namespace {
+
+struct unsq_inclusive_scan_128 {
+  const char* name() const { return "unsq::inclusive_scan<128>"; }
+
+  template <typename I, typename O>
+  O operator()(I f, I l, O o) const {
+    return unsq::inclusive_scan<16 / sizeof(unsq::ValueType<I>)>(f, l, o);
+  }
+};
+
+struct unsq_inclusive_scan_256 {
+  const char* name() const { return "unsq::inclusive_scan<256>"; }
+
+  template <typename I, typename O>
+  O operator()(I f, I l, O o) const {
+    return unsq::inclusive_scan<32 / sizeof(unsq::ValueType<I>)>(f, l, o);
+  }
+};
+
+struct unsq_inclusive_scan_512 {
+  const char* name() const { return "unsq::inclusive_scan<512>"; }
+
+  template <typename I, typename O>
+  O operator()(I f, I l, O o) const {
+    return unsq::inclusive_scan<64 / sizeof(unsq::ValueType<I>)>(f, l, o);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::scan_bench<unsq_inclusive_scan_128,
+                                      unsq_inclusive_scan_256,
+                                      unsq_inclusive_scan_512>>(argc, argv);
+#else
+  bench::bench_main<
+      bench::scan_bench<unsq_inclusive_scan_128, unsq_inclusive_scan_256>>(
+      argc, argv);
+#endif
+}
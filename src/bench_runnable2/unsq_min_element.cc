@@ -0,0 +1,87 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bench/algorithm_benchmarks/min_bench.h"
+
+#include "unsq/find.h"
+#include "unsq/minmax_element.h"
+#include "unsq/reduce.h"
+
+namespace {
+
+struct unsq_min_element_128 {
+  const char* name() const { return "unsq::min_element<128>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    return unsq::min_element<16 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+struct unsq_min_element_256 {
+  const char* name() const { return "unsq::min_element<256>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    return unsq::min_element<32 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+struct unsq_min_element_512 {
+  const char* name() const { return "unsq::min_element<512>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    return unsq::min_element<64 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+// What we had to do before: min_value + find.
+
+struct unsq_min_value_find_256 {
+  const char* name() const { return "unsq::min_value + find<256>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    constexpr std::size_t width = 32 / sizeof(unsq::ValueType<I>);
+    return unsq::find<width>(f, l, *unsq::min_value<width>(f, l));
+  }
+};
+
+struct unsq_min_value_find_512 {
+  const char* name() const { return "unsq::min_value + find<512>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    constexpr std::size_t width = 64 / sizeof(unsq::ValueType<I>);
+    return unsq::find<width>(f, l, *unsq::min_value<width>(f, l));
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::min_bench<
+      unsq_min_element_128, unsq_min_element_256, unsq_min_element_512,
+      unsq_min_value_find_256, unsq_min_value_find_512>>(argc, argv);
+#else
+  bench::bench_main<
+      bench::min_bench<unsq_min_element_128, unsq_min_element_256,
+                       unsq_min_value_find_256>>(argc, argv);
+#endif
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/parallel_reduce_bench.h"
+
+#include <string>
+
+#include "unsq/reduce.h"
+
+namespace {
+
+template <std::size_t n_threads>
+struct unsq_reduce_parallel {
+  const char* name() const {
+    static const std::string res =
+        "unsq::reduce<256>(threads:" + std::to_string(n_threads) + ")";
+    return res.c_str();
+  }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    static algo::thread_pool pool(n_threads);
+    return unsq::reduce<32 / sizeof(unsq::ValueType<I>)>(pool, f, l);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench::bench_main<bench::parallel_reduce_bench<
+      unsq_reduce_parallel<1>, unsq_reduce_parallel<2>,
+      unsq_reduce_parallel<4>, unsq_reduce_parallel<8>,
+      unsq_reduce_parallel<16>>>(argc, argv);
+}
@@ -38,10 +38,25 @@ struct unsq_min_value_v1_256 {
   }
 };
 
+struct unsq_min_value_v1_512 {
+  const char* name() const { return "unsq::v1::min_value<512>"; }
+
+  template <typename I>
+  auto operator()(I f, I l) const {
+    return *unsq::min_value<64 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
 }  // namespace
 
 int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::min_bench<
+      unsq_min_value_v1_128, unsq_min_value_v1_256, unsq_min_value_v1_512>>(
+      argc, argv);
+#else
   bench::bench_main<
       bench::min_bench<unsq_min_value_v1_128, unsq_min_value_v1_256>>(argc,
                                                                       argv);
+#endif
 }
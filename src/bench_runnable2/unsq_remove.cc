@@ -38,9 +38,23 @@ struct unsq_remove_256 {
   }
 };
 
+struct unsq_remove_512 {
+  const char* name() const { return "unsq::remove<512>"; }
+
+  template <typename I, typename T>
+  I operator()(I f, I l, const T& v) const {
+    return unsq::remove<64 / sizeof(unsq::ValueType<I>)>(f, l, v);
+  }
+};
+
 }  // namespace
 
 int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::remove_zeroes<unsq_remove_128, unsq_remove_256,
+                                         unsq_remove_512>>(argc, argv);
+#else
   bench::bench_main<bench::remove_zeroes<unsq_remove_128, unsq_remove_256>>(
       argc, argv);
+#endif
 }
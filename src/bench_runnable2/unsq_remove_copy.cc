@@ -0,0 +1,62 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/remove_zeroes.h"
+
+#include "unsq/remove.h"
+
+namespace {
+
+struct unsq_remove_copy_128 {
+  const char* name() const { return "unsq::remove_copy<128>"; }
+
+  template <typename I, typename O, typename T>
+  O operator()(I f, I l, O o, const T& v) const {
+    return unsq::remove_copy<16 / sizeof(unsq::ValueType<I>)>(f, l, o, v);
+  }
+};
+
+struct unsq_remove_copy_256 {
+  const char* name() const { return "unsq::remove_copy<256>"; }
+
+  template <typename I, typename O, typename T>
+  O operator()(I f, I l, O o, const T& v) const {
+    return unsq::remove_copy<32 / sizeof(unsq::ValueType<I>)>(f, l, o, v);
+  }
+};
+
+struct unsq_remove_copy_512 {
+  const char* name() const { return "unsq::remove_copy<512>"; }
+
+  template <typename I, typename O, typename T>
+  O operator()(I f, I l, O o, const T& v) const {
+    return unsq::remove_copy<64 / sizeof(unsq::ValueType<I>)>(f, l, o, v);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::remove_copy_zeroes<
+      unsq_remove_copy_128, unsq_remove_copy_256, unsq_remove_copy_512>>(argc,
+                                                                         argv);
+#else
+  bench::bench_main<
+      bench::remove_copy_zeroes<unsq_remove_copy_128, unsq_remove_copy_256>>(
+      argc, argv);
+#endif
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench/algorithm_benchmarks/search_text.h"
+
+#include "unsq/search.h"
+
+namespace {
+
+struct unsq_search_128 {
+  const char* name() const { return "unsq::search<128>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 needle_f, I2 needle_l) const {
+    return unsq::search<16>(f, l, needle_f, needle_l);
+  }
+};
+
+struct unsq_search_256 {
+  const char* name() const { return "unsq::search<256>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 needle_f, I2 needle_l) const {
+    return unsq::search<32>(f, l, needle_f, needle_l);
+  }
+};
+
+struct unsq_search_512 {
+  const char* name() const { return "unsq::search<512>"; }
+
+  template <typename I1, typename I2>
+  I1 operator()(I1 f, I1 l, I2 needle_f, I2 needle_l) const {
+    return unsq::search<64>(f, l, needle_f, needle_l);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<
+      bench::search_text<unsq_search_128, unsq_search_256, unsq_search_512>>(
+      argc, argv);
+#else
+  bench::bench_main<bench::search_text<unsq_search_128, unsq_search_256>>(
+      argc, argv);
+#endif
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bench/algorithm_benchmarks/set_operations_bench.h"
+
+#include "unsq/set_operations.h"
+
+namespace {
+
+struct unsq_set_intersection_128 {
+  const char* name() const { return "unsq::set_intersection<128>"; }
+
+  template <typename I, typename O>
+  O operator()(I f1, I l1, I f2, I l2, O o) const {
+    return unsq::set_intersection<16 / sizeof(unsq::ValueType<I>)>(f1, l1, f2,
+                                                                   l2, o);
+  }
+};
+
+struct unsq_set_intersection_256 {
+  const char* name() const { return "unsq::set_intersection<256>"; }
+
+  template <typename I, typename O>
+  O operator()(I f1, I l1, I f2, I l2, O o) const {
+    return unsq::set_intersection<32 / sizeof(unsq::ValueType<I>)>(f1, l1, f2,
+                                                                   l2, o);
+  }
+};
+
+struct unsq_set_intersection_512 {
+  const char* name() const { return "unsq::set_intersection<512>"; }
+
+  template <typename I, typename O>
+  O operator()(I f1, I l1, I f2, I l2, O o) const {
+    return unsq::set_intersection<64 / sizeof(unsq::ValueType<I>)>(f1, l1, f2,
+                                                                   l2, o);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<
+      bench::set_intersection_selectivity<unsq_set_intersection_128,
+                                          unsq_set_intersection_256,
+                                          unsq_set_intersection_512>,
+      bench::set_intersection_size_ratio<unsq_set_intersection_128,
+                                         unsq_set_intersection_256,
+                                         unsq_set_intersection_512>>(argc,
+                                                                     argv);
+#else
+  bench::bench_main<
+      bench::set_intersection_selectivity<unsq_set_intersection_128,
+                                          unsq_set_intersection_256>,
+      bench::set_intersection_size_ratio<unsq_set_intersection_128,
+                                         unsq_set_intersection_256>>(argc,
+                                                                     argv);
+#endif
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bench/algorithm_benchmarks/unique_bench.h"
+
+#include "unsq/unique.h"
+
+namespace {
+
+struct unsq_unique_128 {
+  const char* name() const { return "unsq::unique<128>"; }
+
+  template <typename I>
+  I operator()(I f, I l) const {
+    return unsq::unique<16 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+struct unsq_unique_256 {
+  const char* name() const { return "unsq::unique<256>"; }
+
+  template <typename I>
+  I operator()(I f, I l) const {
+    return unsq::unique<32 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+struct unsq_unique_512 {
+  const char* name() const { return "unsq::unique<512>"; }
+
+  template <typename I>
+  I operator()(I f, I l) const {
+    return unsq::unique<64 / sizeof(unsq::ValueType<I>)>(f, l);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+#ifdef __AVX512BW__
+  bench::bench_main<bench::unique_sorted<unsq_unique_128, unsq_unique_256,
+                                         unsq_unique_512>>(argc, argv);
+#else
+  bench::bench_main<bench::unique_sorted<unsq_unique_128, unsq_unique_256>>(
+      argc, argv);
+#endif
+}
@@ -19,4 +19,11 @@
 
 #define ALGO_NOINLINE __attribute__((noinline))
 
+// Inlines everything that is called from the function.
+#define ALGO_FLATTEN __attribute__((flatten))
+
+// Hint to start loading the cache line with `addr`, it's not an error if
+// `addr` is not a valid address.
+#define ALGO_PREFETCH(addr) __builtin_prefetch(addr)
+
 #endif  // COMPILER_COMPILER_DIRECTIVES_H
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dispatch/dispatch.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "dispatch/functions.h"
+
+namespace dispatch {
+namespace {
+
+template <typename T>
+void fill_missing(typed_functions<T>& x, const functions& fallback) {
+  const typed_functions<T>& from = get<T>(fallback);
+  if (!x.find) x.find = from.find;
+  if (!x.remove) x.remove = from.remove;
+  if (!x.reduce) x.reduce = from.reduce;
+}
+
+functions with_fallback(functions x, const functions& fallback) {
+  std::apply([&](auto&... typed) { (fill_missing(typed, fallback), ...); },
+             x.typed);
+  if (!x.strlen) x.strlen = fallback.strlen;
+  if (!x.strcmp) x.strcmp = fallback.strcmp;
+  return x;
+}
+
+const functions& selected_functions() {
+  static const functions& res = functions_for(selected_isa());
+  return res;
+}
+
+}  // namespace
+
+const char* isa_name(isa x) {
+  switch (x) {
+    case isa::generic:
+      return "generic";
+    case isa::sse4_2:
+      return "sse4.2";
+    case isa::avx2:
+      return "avx2";
+    case isa::avx512:
+      return "avx512";
+  }
+  return "unknown";
+}
+
+// Flags have to match what the corresponding translation unit
+// is compiled with.
+bool is_supported(isa x) {
+  __builtin_cpu_init();
+
+  switch (x) {
+    case isa::generic:
+      return true;
+    case isa::sse4_2:
+      return __builtin_cpu_supports("sse4.2") &&
+             __builtin_cpu_supports("popcnt");
+    case isa::avx2:
+      return is_supported(isa::sse4_2) && __builtin_cpu_supports("avx2") &&
+             __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2");
+    case isa::avx512:
+      return is_supported(isa::avx2) && __builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512dq") &&
+             __builtin_cpu_supports("avx512vl");
+  }
+  return false;
+}
+
+isa selected_isa() {
+  static const isa res = [] {
+    for (isa x : {isa::avx512, isa::avx2, isa::sse4_2}) {
+      if (is_supported(x)) return x;
+    }
+    return isa::generic;
+  }();
+  return res;
+}
+
+const functions& functions_for(isa x) {
+  if (!is_supported(x)) {
+    throw std::invalid_argument(std::string("unsupported isa: ") +
+                                isa_name(x));
+  }
+
+  switch (x) {
+    case isa::generic: {
+      static const functions res = generic_functions();
+      return res;
+    }
+    case isa::sse4_2: {
+      static const functions res =
+          with_fallback(sse4_2_functions(), functions_for(isa::generic));
+      return res;
+    }
+    case isa::avx2: {
+      static const functions res =
+          with_fallback(avx2_functions(), functions_for(isa::sse4_2));
+      return res;
+    }
+    case isa::avx512: {
+      static const functions res =
+          with_fallback(avx512_functions(), functions_for(isa::avx2));
+      return res;
+    }
+  }
+  throw std::invalid_argument("unknown isa");
+}
+
+template <typename T>
+const T* find(const T* f, const T* l, T x) {
+  return get<T>(selected_functions()).find(f, l, x);
+}
+
+template <typename T>
+T* remove(T* f, T* l, T x) {
+  return get<T>(selected_functions()).remove(f, l, x);
+}
+
+template <typename T>
+T reduce(const T* f, const T* l) {
+  return get<T>(selected_functions()).reduce(f, l);
+}
+
+std::size_t strlen(const char* s) { return selected_functions().strlen(s); }
+
+int strcmp(const char* x, const char* y) {
+  return selected_functions().strcmp(x, y);
+}
+
+#define DISPATCH_INSTANTIATE(T)                   \
+  template const T* find(const T*, const T*, T); \
+  template T* remove(T*, T*, T);                 \
+  template T reduce(const T*, const T*);
+
+DISPATCH_INSTANTIATE(std::int8_t)
+DISPATCH_INSTANTIATE(std::uint8_t)
+DISPATCH_INSTANTIATE(std::int16_t)
+DISPATCH_INSTANTIATE(std::uint16_t)
+DISPATCH_INSTANTIATE(std::int32_t)
+DISPATCH_INSTANTIATE(std::uint32_t)
+DISPATCH_INSTANTIATE(std::int64_t)
+DISPATCH_INSTANTIATE(std::uint64_t)
+DISPATCH_INSTANTIATE(float)
+DISPATCH_INSTANTIATE(double)
+
+#undef DISPATCH_INSTANTIATE
+
+}  // namespace dispatch
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISPATCH_DISPATCH_H_
+#define DISPATCH_DISPATCH_H_
+
+#include <cstddef>
+
+namespace dispatch {
+
+// Instruction sets we compile code for, from the least capable.
+enum class isa { generic, sse4_2, avx2, avx512 };
+
+const char* isa_name(isa x);
+
+bool is_supported(isa x);
+
+// The best supported isa, detected once.
+isa selected_isa();
+
+// T is one of: std::int8_t ... std::uint64_t, float, double.
+
+template <typename T>
+const T* find(const T* f, const T* l, T x);
+
+template <typename T>
+T* remove(T* f, T* l, T x);
+
+// Sum of the range. For floating point the order of additions is unspecified.
+template <typename T>
+T reduce(const T* f, const T* l);
+
+std::size_t strlen(const char* s);
+
+int strcmp(const char* x, const char* y);
+
+}  // namespace dispatch
+
+#endif  // DISPATCH_DISPATCH_H_
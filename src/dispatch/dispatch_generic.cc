@@ -0,0 +1,68 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "compiler/compiler_directives.h"
+#include "dispatch/functions.h"
+
+namespace dispatch {
+namespace {
+
+// Flattened for the same reason as simd functions: std algorithms
+// can be instantiated in code compiled for a newer cpu.
+
+template <typename T>
+ALGO_FLATTEN const T* std_find(const T* f, const T* l, T x) {
+  return std::find(f, l, x);
+}
+
+template <typename T>
+ALGO_FLATTEN T* std_remove(T* f, T* l, T x) {
+  return std::remove(f, l, x);
+}
+
+template <typename T>
+ALGO_FLATTEN T std_reduce(const T* f, const T* l) {
+  return std::accumulate(f, l, T{});
+}
+
+ALGO_FLATTEN std::size_t std_strlen(const char* s) { return std::strlen(s); }
+
+ALGO_FLATTEN int std_strcmp(const char* x, const char* y) {
+  return std::strcmp(x, y);
+}
+
+template <typename T>
+void fill(typed_functions<T>& typed) {
+  typed.find = std_find<T>;
+  typed.remove = std_remove<T>;
+  typed.reduce = std_reduce<T>;
+}
+
+}  // namespace
+
+functions generic_functions() {
+  functions res;
+  std::apply([&](auto&... typed) { (fill(typed), ...); }, res.typed);
+  res.strlen = std_strlen;
+  res.strcmp = std_strcmp;
+  return res;
+}
+
+}  // namespace dispatch
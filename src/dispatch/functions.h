@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISPATCH_FUNCTIONS_H_
+#define DISPATCH_FUNCTIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "dispatch/dispatch.h"
+
+namespace dispatch {
+
+template <typename T>
+struct typed_functions {
+  const T* (*find)(const T*, const T*, T) = nullptr;
+  T* (*remove)(T*, T*, T) = nullptr;
+  T (*reduce)(const T*, const T*) = nullptr;
+};
+
+// nullptr means that the isa doesn't have it's own version,
+// one for the less capable isa should be used.
+struct functions {
+  std::tuple<typed_functions<std::int8_t>, typed_functions<std::uint8_t>,
+             typed_functions<std::int16_t>, typed_functions<std::uint16_t>,
+             typed_functions<std::int32_t>, typed_functions<std::uint32_t>,
+             typed_functions<std::int64_t>, typed_functions<std::uint64_t>,
+             typed_functions<float>, typed_functions<double>>
+      typed;
+
+  std::size_t (*strlen)(const char*) = nullptr;
+  int (*strcmp)(const char*, const char*) = nullptr;
+};
+
+template <typename T>
+typed_functions<T>& get(functions& x) {
+  return std::get<typed_functions<T>>(x.typed);
+}
+
+template <typename T>
+const typed_functions<T>& get(const functions& x) {
+  return std::get<typed_functions<T>>(x.typed);
+}
+
+// Each is defined in a separate translation unit, compiled for that isa.
+// Should only be called if the isa is supported.
+functions generic_functions();
+functions sse4_2_functions();
+functions avx2_functions();
+functions avx512_functions();
+
+// All of the functions for an isa, including the ones
+// that come from less capable isas.
+const functions& functions_for(isa x);
+
+}  // namespace dispatch
+
+#endif  // DISPATCH_FUNCTIONS_H_
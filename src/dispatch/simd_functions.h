@@ -0,0 +1,91 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISPATCH_SIMD_FUNCTIONS_H_
+#define DISPATCH_SIMD_FUNCTIONS_H_
+
+#include "algo/strcmp.h"
+#include "algo/strlen.h"
+#include "compiler/compiler_directives.h"
+#include "dispatch/functions.h"
+#include "unsq/find.h"
+#include "unsq/reduce.h"
+#include "unsq/remove.h"
+
+// Only to be included in the isa specific translation units.
+//
+// All of the simd code is templates and inline functions, so identical
+// instantiations from different translation units are merged by the linker
+// and we don't control which one stays. To not end up running avx512 code
+// on an avx2 machine, the entry points are flattened (everything is inlined
+// into them) and instantiated with a byte_width unique to the isa.
+
+namespace dispatch {
+namespace _simd_functions {
+
+template <std::size_t byte_width, typename T>
+ALGO_FLATTEN const T* find(const T* f, const T* l, T x) {
+  return unsq::find<byte_width / sizeof(T)>(f, l, x);
+}
+
+template <std::size_t byte_width, typename T>
+ALGO_FLATTEN T* remove(T* f, T* l, T x) {
+  return unsq::remove<byte_width / sizeof(T)>(f, l, x);
+}
+
+template <std::size_t byte_width, typename T>
+ALGO_FLATTEN T reduce(const T* f, const T* l) {
+  return unsq::reduce<byte_width / sizeof(T)>(f, l);
+}
+
+template <std::size_t byte_width>
+ALGO_FLATTEN std::size_t strlen(const char* s) {
+  return algo::strlen<byte_width>(s);
+}
+
+template <std::size_t byte_width>
+ALGO_FLATTEN int strcmp(const char* x, const char* y) {
+  return algo::strcmp<byte_width>(x, y);
+}
+
+template <std::size_t byte_width, bool with_remove, typename T>
+void fill(typed_functions<T>& typed) {
+  typed.find = find<byte_width, T>;
+  if constexpr (with_remove) typed.remove = remove<byte_width, T>;
+  typed.reduce = reduce<byte_width, T>;
+}
+
+}  // namespace _simd_functions
+
+// Remove needs BMI2 for the compress masks, so it's optional.
+template <std::size_t byte_width, bool with_remove>
+functions simd_functions() {
+  functions res;
+
+  std::apply(
+      [&](auto&... typed) {
+        (_simd_functions::fill<byte_width, with_remove>(typed), ...);
+      },
+      res.typed);
+
+  res.strlen = _simd_functions::strlen<byte_width>;
+  res.strcmp = _simd_functions::strcmp<byte_width>;
+  return res;
+}
+
+}  // namespace dispatch
+
+#endif  // DISPATCH_SIMD_FUNCTIONS_H_
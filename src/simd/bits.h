@@ -26,6 +26,28 @@ inline std::int32_t count_trailing_zeroes(std::uint32_t x) {
   return __builtin_ctz(x);
 }
 
+inline std::int32_t count_trailing_zeroes(std::uint64_t x) {
+  return __builtin_ctzll(x);
+}
+
+// x != 0
+inline std::int32_t count_leading_zeroes(std::uint32_t x) {
+  return __builtin_clz(x);
+}
+
+// x != 0
+inline std::int32_t count_leading_zeroes(std::uint64_t x) {
+  return __builtin_clzll(x);
+}
+
+inline std::int32_t popcount(std::uint32_t x) {
+  return __builtin_popcount(x);
+}
+
+inline std::int32_t popcount(std::uint64_t x) {
+  return __builtin_popcountll(x);
+}
+
 // https://stackoverflow.com/questions/18806481/how-can-i-get-the-position-of-the-least-significant-bit-in-a-number
 inline std::uint32_t lsb(std::uint32_t x) {
   return x & -x;
@@ -45,11 +67,23 @@ inline bool lsb_less(std::uint32_t x, std::uint32_t y) {
   return lsb(x) > lsb(y);
 }
 
-constexpr std::uint32_t set_lower_n_bits(std::uint32_t n) {
-  std::uint64_t res{1};
-  res <<= n;
-  res -= 1;
-  return static_cast<std::uint32_t>(res);
+template <typename N>
+constexpr N all_ones() {
+  return ~N{0};
+}
+
+template <typename N = std::uint32_t>
+constexpr N set_lower_n_bits(std::uint32_t n) {
+  if constexpr (sizeof(N) < sizeof(std::uint64_t)) {
+    std::uint64_t res{1};
+    res <<= n;
+    res -= 1;
+    return static_cast<N>(res);
+  } else {
+    // Shifting by 64 is UB, have to special case.
+    if (n == 64) return all_ones<N>();
+    return (N{1} << n) - 1;
+  }
 }
 
 template <typename N>
@@ -59,11 +93,6 @@ constexpr N set_highest_4_bits() {
   return res;
 }
 
-template <typename N>
-constexpr N all_ones() {
-  return ~N{0};
-}
-
 }  // namespace simd
 
 #endif  // SIMD_PACK_DETAIL_BITS_H_
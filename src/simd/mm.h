@@ -67,15 +67,61 @@ constexpr auto register_i_impl() {
 template <std::size_t W>
 using register_i = typename decltype(_mm::register_i_impl<W>())::type;
 
+// register_ps -----------------------------
+
+namespace _mm {
+
+template <std::size_t W>
+constexpr auto register_ps_impl() {
+  if constexpr (W == 128)
+    return type_t<__m128>{};
+  else if constexpr (W == 256)
+    return type_t<__m256>{};
+  else if constexpr (W == 512)
+    return type_t<__m512>{};
+  else
+    return error_t{};
+}
+}  // namespace _mm
+
+template <std::size_t W>
+using register_ps = typename decltype(_mm::register_ps_impl<W>())::type;
+
+// register_pd -----------------------------
+
+namespace _mm {
+
+template <std::size_t W>
+constexpr auto register_pd_impl() {
+  if constexpr (W == 128)
+    return type_t<__m128d>{};
+  else if constexpr (W == 256)
+    return type_t<__m256d>{};
+  else if constexpr (W == 512)
+    return type_t<__m512d>{};
+  else
+    return error_t{};
+}
+}  // namespace _mm
+
+template <std::size_t W>
+using register_pd = typename decltype(_mm::register_pd_impl<W>())::type;
+
 // sizes -----------------------------------
 
 template <typename Register>
 constexpr std::size_t bit_width() {
-  if constexpr (std::is_same_v<Register, register_i<128>>) {
+  if constexpr (std::is_same_v<Register, register_i<128>> ||
+                std::is_same_v<Register, register_ps<128>> ||
+                std::is_same_v<Register, register_pd<128>>) {
     return 128;
-  } else if constexpr (std::is_same_v<Register, register_i<256>>) {
+  } else if constexpr (std::is_same_v<Register, register_i<256>> ||
+                       std::is_same_v<Register, register_ps<256>> ||
+                       std::is_same_v<Register, register_pd<256>>) {
     return 256;
-  } else if constexpr (std::is_same_v<Register, register_i<512>>) {
+  } else if constexpr (std::is_same_v<Register, register_i<512>> ||
+                       std::is_same_v<Register, register_ps<512>> ||
+                       std::is_same_v<Register, register_pd<512>>) {
     return 512;
   }
   throw error_t{};
@@ -147,6 +193,114 @@ inline void storeu(register_i<512>* addr, register_i<512> a) {
   _mm512_storeu_si512(addr, a);
 }
 
+__attribute__((no_sanitize_address)) inline register_ps<128> load(
+    const register_ps<128>* addr) {
+  return _mm_load_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_ps<256> load(
+    const register_ps<256>* addr) {
+  return _mm256_load_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_ps<512> load(
+    const register_ps<512>* addr) {
+  return _mm512_load_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<128> load(
+    const register_pd<128>* addr) {
+  return _mm_load_pd(reinterpret_cast<const double*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<256> load(
+    const register_pd<256>* addr) {
+  return _mm256_load_pd(reinterpret_cast<const double*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<512> load(
+    const register_pd<512>* addr) {
+  return _mm512_load_pd(reinterpret_cast<const double*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_ps<128> loadu(
+    const register_ps<128>* addr) {
+  return _mm_loadu_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_ps<256> loadu(
+    const register_ps<256>* addr) {
+  return _mm256_loadu_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_ps<512> loadu(
+    const register_ps<512>* addr) {
+  return _mm512_loadu_ps(reinterpret_cast<const float*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<128> loadu(
+    const register_pd<128>* addr) {
+  return _mm_loadu_pd(reinterpret_cast<const double*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<256> loadu(
+    const register_pd<256>* addr) {
+  return _mm256_loadu_pd(reinterpret_cast<const double*>(addr));
+}
+
+__attribute__((no_sanitize_address)) inline register_pd<512> loadu(
+    const register_pd<512>* addr) {
+  return _mm512_loadu_pd(reinterpret_cast<const double*>(addr));
+}
+
+inline void store(register_ps<128>* addr, register_ps<128> a) {
+  _mm_store_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void store(register_ps<256>* addr, register_ps<256> a) {
+  _mm256_store_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void store(register_ps<512>* addr, register_ps<512> a) {
+  _mm512_store_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void store(register_pd<128>* addr, register_pd<128> a) {
+  _mm_store_pd(reinterpret_cast<double*>(addr), a);
+}
+
+inline void store(register_pd<256>* addr, register_pd<256> a) {
+  _mm256_store_pd(reinterpret_cast<double*>(addr), a);
+}
+
+inline void store(register_pd<512>* addr, register_pd<512> a) {
+  _mm512_store_pd(reinterpret_cast<double*>(addr), a);
+}
+
+inline void storeu(register_ps<128>* addr, register_ps<128> a) {
+  _mm_storeu_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void storeu(register_ps<256>* addr, register_ps<256> a) {
+  _mm256_storeu_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void storeu(register_ps<512>* addr, register_ps<512> a) {
+  _mm512_storeu_ps(reinterpret_cast<float*>(addr), a);
+}
+
+inline void storeu(register_pd<128>* addr, register_pd<128> a) {
+  _mm_storeu_pd(reinterpret_cast<double*>(addr), a);
+}
+
+inline void storeu(register_pd<256>* addr, register_pd<256> a) {
+  _mm256_storeu_pd(reinterpret_cast<double*>(addr), a);
+}
+
+inline void storeu(register_pd<512>* addr, register_pd<512> a) {
+  _mm512_storeu_pd(reinterpret_cast<double*>(addr), a);
+}
+
 inline void maskmoveu(register_i<128>* addr, register_i<128> a,
                       register_i<128> mask) {
   { _mm_maskmoveu_si128(a, mask, reinterpret_cast<char*>(addr)); }
@@ -154,11 +308,22 @@ inline void maskmoveu(register_i<128>* addr, register_i<128> a,
 
 // set one value everywhere ----------------
 
-// Does not exist for floats.
 template <typename Register>
 inline auto setzero() {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128)
+  if constexpr (std::is_same_v<Register, register_ps<128>>)
+    return _mm_setzero_ps();
+  else if constexpr (std::is_same_v<Register, register_ps<256>>)
+    return _mm256_setzero_ps();
+  else if constexpr (std::is_same_v<Register, register_ps<512>>)
+    return _mm512_setzero_ps();
+  else if constexpr (std::is_same_v<Register, register_pd<128>>)
+    return _mm_setzero_pd();
+  else if constexpr (std::is_same_v<Register, register_pd<256>>)
+    return _mm256_setzero_pd();
+  else if constexpr (std::is_same_v<Register, register_pd<512>>)
+    return _mm512_setzero_pd();
+  else if constexpr (register_width == 128)
     return _mm_setzero_si128();
   else if constexpr (register_width == 256)
     return _mm256_setzero_si256();
@@ -173,7 +338,19 @@ inline auto set1(T a) {
   static constexpr std::size_t register_width = bit_width<Register>();
   static constexpr std::size_t t_width = sizeof(T) * 8;
 
-  if constexpr (register_width == 128 && t_width == 8)
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_set1_ps(a);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_set1_ps(a);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_set1_ps(a);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_set1_pd(a);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_set1_pd(a);
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_set1_pd(a);
+  else if constexpr (register_width == 128 && t_width == 8)
     return _mm_set1_epi8((std::int8_t)a);
   else if constexpr (register_width == 128 && t_width == 16)
     return _mm_set1_epi16((std::int16_t)a);
@@ -207,7 +384,19 @@ template <typename T, typename Register>
 inline auto min(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 
-  if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_min_ps(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_min_ps(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_min_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_min_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_min_pd(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_min_pd(a, b);
+  else if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
     return _mm_min_epi8(a, b);
   else if constexpr (register_width == 128 && is_equivalent<T, std::uint8_t>())
     return _mm_min_epu8(a, b);
@@ -263,7 +452,19 @@ template <typename T, typename Register>
 inline auto max(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 
-  if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_max_ps(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_max_ps(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_max_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_max_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_max_pd(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_max_pd(a, b);
+  else if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
     return _mm_max_epi8(a, b);
   else if constexpr (register_width == 128 && is_equivalent<T, std::uint8_t>())
     return _mm_max_epu8(a, b);
@@ -321,7 +522,19 @@ template <typename T, typename Register>
 inline auto cmpeq(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
   static constexpr std::size_t t_width = sizeof(T) * 8;
-  if constexpr (register_width == 128 && t_width == 8)
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_cmpeq_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_cmpeq_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_movm_epi32(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ));
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_movm_epi64(_mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ));
+  else if constexpr (register_width == 128 && t_width == 8)
     return _mm_cmpeq_epi8(a, b);
   else if constexpr (register_width == 128 && t_width == 16)
     return _mm_cmpeq_epi16(a, b);
@@ -338,13 +551,13 @@ inline auto cmpeq(Register a, Register b) {
   else if constexpr (register_width == 256 && t_width == 64)
     return _mm256_cmpeq_epi64(a, b);
   else if constexpr (register_width == 512 && t_width == 8)
-    return _mm512_cmpeq_epi8(a, b);
+    return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a, b));
   else if constexpr (register_width == 512 && t_width == 16)
-    return _mm512_cmpeq_epi16(a, b);
+    return _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a, b));
   else if constexpr (register_width == 512 && t_width == 32)
-    return _mm512_cmpeq_epi32(a, b);
+    return _mm512_movm_epi32(_mm512_cmpeq_epi32_mask(a, b));
   else if constexpr (register_width == 512 && t_width == 64)
-    return _mm512_cmpeq_epi64(a, b);
+    return _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b));
   else
     return error_t{};
 }
@@ -353,7 +566,19 @@ inline auto cmpeq(Register a, Register b) {
 template <typename T, typename Register>
 inline auto cmpgt(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_cmpgt_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_cmpgt_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_movm_epi32(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ));
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_movm_epi64(_mm512_cmp_pd_mask(a, b, _CMP_GT_OQ));
+  else if constexpr (register_width == 128 && is_equivalent<T, std::int8_t>())
     return _mm_cmpgt_epi8(a, b);
   else if constexpr (register_width == 128 && is_equivalent<T, std::int16_t>())
     return _mm_cmpgt_epi16(a, b);
@@ -370,13 +595,13 @@ inline auto cmpgt(Register a, Register b) {
   else if constexpr (register_width == 256 && is_equivalent<T, std::int64_t>())
     return _mm256_cmpgt_epi64(a, b);
   else if constexpr (register_width == 512 && is_equivalent<T, std::int8_t>())
-    return _mm512_cmpgt_epi8(a, b);
+    return _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a, b));
   else if constexpr (register_width == 512 && is_equivalent<T, std::int16_t>())
-    return _mm512_cmpgt_epi16(a, b);
+    return _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a, b));
   else if constexpr (register_width == 512 && is_equivalent<T, std::int32_t>())
-    return _mm512_cmpgt_epi32(a, b);
+    return _mm512_movm_epi32(_mm512_cmpgt_epi32_mask(a, b));
   else if constexpr (register_width == 512 && is_equivalent<T, std::int64_t>())
-    return _mm512_cmpgt_epi64(a, b);
+    return _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a, b));
   else
     return error_t{};
 }
@@ -387,7 +612,19 @@ template <typename T, typename Register>
 inline auto add(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
   static constexpr std::size_t t_width = sizeof(T) * 8;
-  if constexpr (register_width == 128 && t_width == 8)
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_add_ps(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_add_ps(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_add_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_add_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_add_pd(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_add_pd(a, b);
+  else if constexpr (register_width == 128 && t_width == 8)
     return _mm_add_epi8(a, b);
   else if constexpr (register_width == 128 && t_width == 16)
     return _mm_add_epi16(a, b);
@@ -419,7 +656,19 @@ template <typename T, typename Register>
 inline auto sub(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
   static constexpr std::size_t t_width = sizeof(T) * 8;
-  if constexpr (register_width == 128 && t_width == 8)
+  if constexpr (register_width == 128 && std::is_same_v<T, float>)
+    return _mm_sub_ps(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, float>)
+    return _mm256_sub_ps(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, float>)
+    return _mm512_sub_ps(a, b);
+  else if constexpr (register_width == 128 && std::is_same_v<T, double>)
+    return _mm_sub_pd(a, b);
+  else if constexpr (register_width == 256 && std::is_same_v<T, double>)
+    return _mm256_sub_pd(a, b);
+  else if constexpr (register_width == 512 && std::is_same_v<T, double>)
+    return _mm512_sub_pd(a, b);
+  else if constexpr (register_width == 128 && t_width == 8)
     return _mm_sub_epi8(a, b);
   else if constexpr (register_width == 128 && t_width == 16)
     return _mm_sub_epi16(a, b);
@@ -458,6 +707,8 @@ inline auto movemask(Register a) {
     return _mm_movemask_epi8(a);
   else if constexpr (register_width == 256 && t_width == 8)
     return _mm256_movemask_epi8(a);
+  else if constexpr (register_width == 512 && t_width == 8)
+    return _mm512_movepi8_mask(a);
   else
     return error_t{};
 }
@@ -471,6 +722,8 @@ inline auto blendv(Register a, Register b, Register mask) {
     return _mm_blendv_epi8(a, b, mask);
   else if constexpr (register_width == 256 && t_width == 8)
     return _mm256_blendv_epi8(a, b, mask);
+  else if constexpr (register_width == 512 && t_width == 8)
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b);
   else
     return error_t{};
 }
@@ -480,7 +733,19 @@ inline auto blendv(Register a, Register b, Register mask) {
 template <typename Register>
 inline auto and_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128)
+  if constexpr (std::is_same_v<Register, register_ps<128>>)
+    return _mm_and_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<256>>)
+    return _mm256_and_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<512>>)
+    return _mm512_and_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<128>>)
+    return _mm_and_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<256>>)
+    return _mm256_and_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<512>>)
+    return _mm512_and_pd(a, b);
+  else if constexpr (register_width == 128)
     return _mm_and_si128(a, b);
   else if constexpr (register_width == 256)
     return _mm256_and_si256(a, b);
@@ -493,7 +758,19 @@ inline auto and_(Register a, Register b) {
 template <typename Register>
 inline auto or_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128)
+  if constexpr (std::is_same_v<Register, register_ps<128>>)
+    return _mm_or_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<256>>)
+    return _mm256_or_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<512>>)
+    return _mm512_or_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<128>>)
+    return _mm_or_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<256>>)
+    return _mm256_or_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<512>>)
+    return _mm512_or_pd(a, b);
+  else if constexpr (register_width == 128)
     return _mm_or_si128(a, b);
   else if constexpr (register_width == 256)
     return _mm256_or_si256(a, b);
@@ -506,7 +783,19 @@ inline auto or_(Register a, Register b) {
 template <typename Register>
 inline auto xor_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128)
+  if constexpr (std::is_same_v<Register, register_ps<128>>)
+    return _mm_xor_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<256>>)
+    return _mm256_xor_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<512>>)
+    return _mm512_xor_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<128>>)
+    return _mm_xor_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<256>>)
+    return _mm256_xor_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<512>>)
+    return _mm512_xor_pd(a, b);
+  else if constexpr (register_width == 128)
     return _mm_xor_si128(a, b);
   else if constexpr (register_width == 256)
     return _mm256_xor_si256(a, b);
@@ -519,7 +808,19 @@ inline auto xor_(Register a, Register b) {
 template <typename Register>
 inline auto andnot(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
-  if constexpr (register_width == 128)
+  if constexpr (std::is_same_v<Register, register_ps<128>>)
+    return _mm_andnot_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<256>>)
+    return _mm256_andnot_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_ps<512>>)
+    return _mm512_andnot_ps(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<128>>)
+    return _mm_andnot_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<256>>)
+    return _mm256_andnot_pd(a, b);
+  else if constexpr (std::is_same_v<Register, register_pd<512>>)
+    return _mm512_andnot_pd(a, b);
+  else if constexpr (register_width == 128)
     return _mm_andnot_si128(a, b);
   else if constexpr (register_width == 256)
     return _mm256_andnot_si256(a, b);
@@ -529,6 +830,74 @@ inline auto andnot(Register a, Register b) {
     return error_t{};
 }
 
+// casts -----------------------------------
+
+// Reinterprets bits between registers of the same width.
+template <typename To, typename From>
+inline auto cast(From a) {
+  static constexpr std::size_t register_width = bit_width<From>();
+  static_assert(register_width == bit_width<To>());
+
+  if constexpr (std::is_same_v<To, From>)
+    return a;
+  else if constexpr (std::is_same_v<To, register_i<128>> &&
+                     std::is_same_v<From, register_ps<128>>)
+    return _mm_castps_si128(a);
+  else if constexpr (std::is_same_v<To, register_i<128>> &&
+                     std::is_same_v<From, register_pd<128>>)
+    return _mm_castpd_si128(a);
+  else if constexpr (std::is_same_v<To, register_ps<128>> &&
+                     std::is_same_v<From, register_i<128>>)
+    return _mm_castsi128_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<128>> &&
+                     std::is_same_v<From, register_i<128>>)
+    return _mm_castsi128_pd(a);
+  else if constexpr (std::is_same_v<To, register_ps<128>> &&
+                     std::is_same_v<From, register_pd<128>>)
+    return _mm_castpd_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<128>> &&
+                     std::is_same_v<From, register_ps<128>>)
+    return _mm_castps_pd(a);
+  else if constexpr (std::is_same_v<To, register_i<256>> &&
+                     std::is_same_v<From, register_ps<256>>)
+    return _mm256_castps_si256(a);
+  else if constexpr (std::is_same_v<To, register_i<256>> &&
+                     std::is_same_v<From, register_pd<256>>)
+    return _mm256_castpd_si256(a);
+  else if constexpr (std::is_same_v<To, register_ps<256>> &&
+                     std::is_same_v<From, register_i<256>>)
+    return _mm256_castsi256_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<256>> &&
+                     std::is_same_v<From, register_i<256>>)
+    return _mm256_castsi256_pd(a);
+  else if constexpr (std::is_same_v<To, register_ps<256>> &&
+                     std::is_same_v<From, register_pd<256>>)
+    return _mm256_castpd_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<256>> &&
+                     std::is_same_v<From, register_ps<256>>)
+    return _mm256_castps_pd(a);
+  else if constexpr (std::is_same_v<To, register_i<512>> &&
+                     std::is_same_v<From, register_ps<512>>)
+    return _mm512_castps_si512(a);
+  else if constexpr (std::is_same_v<To, register_i<512>> &&
+                     std::is_same_v<From, register_pd<512>>)
+    return _mm512_castpd_si512(a);
+  else if constexpr (std::is_same_v<To, register_ps<512>> &&
+                     std::is_same_v<From, register_i<512>>)
+    return _mm512_castsi512_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<512>> &&
+                     std::is_same_v<From, register_i<512>>)
+    return _mm512_castsi512_pd(a);
+  else if constexpr (std::is_same_v<To, register_ps<512>> &&
+                     std::is_same_v<From, register_pd<512>>)
+    return _mm512_castpd_ps(a);
+  else if constexpr (std::is_same_v<To, register_pd<512>> &&
+                     std::is_same_v<From, register_ps<512>>)
+    return _mm512_castps_pd(a);
+  else
+    return error_t{};
+}
+
 }  // namespace mm
 
 #endif  // SIMD_MM_H_
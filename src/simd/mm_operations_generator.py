@@ -130,17 +130,21 @@ def ifConstexprPattern(condition, block, data):
 
 widthNamePairs = [(128, ''), (256, '256'), (512, '512')]
 
+# AVX-512 often has different instructions (i.e. comparisons return masks).
+avx2WidthNamePairs = widthNamePairs[:2]
+avx512WidthNamePairs = widthNamePairs[2:]
+
 
 def instantiateJustRegister(template):
     return '\n'.join([template.format(size, name) for size, name in widthNamePairs])
 
 
-def instantiateRegisterIntWidth(template, include64=True):
+def instantiateRegisterIntWidth(template, include64=True, widths=widthNamePairs):
     intWidth = [8, 16, 32]
     if include64:
         intWidth.append(64)
 
-    product = list(itertools.product(widthNamePairs, intWidth))
+    product = list(itertools.product(widths, intWidth))
     flatten = list(itertools.chain(product))
 
     return '\n'.join(
@@ -159,27 +163,61 @@ def instantiateIfConstexprPattern_intWidth(condition, action):
     return instantiateRegisterIntWidth(pattern) + '  return error_t{}; }\n'
 
 
+# Comparisons on AVX-512 return a mask register, we convert it back
+# to a vector to be consistent with smaller registers.
+def instantiateIfConstexprPattern_intWidth_avx512Mask(condition, action, maskAction):
+    pattern = 'if constexpr (' + condition + ')' + action + 'else'
+    maskPattern = 'if constexpr (' + condition + ')' + maskAction + 'else'
+    return instantiateRegisterIntWidth(pattern, widths=avx2WidthNamePairs) + \
+        instantiateRegisterIntWidth(maskPattern, widths=avx512WidthNamePairs) + \
+        '  return error_t{}; }\n'
+
+
 def instantiateIfConstexprPattern_intWidth_twice(condition1, action1, condition2, action2):
     pattern = 'if constexpr (' + condition1 + ')' + action1 + 'else '
     pattern += 'if constexpr (' + condition2 + ')' + action2 + 'else'
     return instantiateRegisterIntWidth(pattern) + '  return error_t{}; }\n'
 
 
+# Floating point registers are named by the suffix intel uses for
+# the instructions on them: register_ps for floats, register_pd for doubles.
+floatingKinds = [('ps', 'float'), ('pd', 'double')]
+
+
+def ifConstexprChainOpen(conditionAction):
+    return ''.join(
+        ['if constexpr (' + c + ')' + a + 'else ' for c, a in conditionAction]
+    )
+
+
+def instantiateFloatingRegister(template):
+    return '\n'.join(
+        [template.format(size, name, kind, scalar)
+         for kind, scalar in floatingKinds
+         for size, name in widthNamePairs]
+    )
+
+
+def instantiateIfConstexprPattern_floating(condition, action):
+    pattern = 'if constexpr (' + condition + ')' + action + 'else'
+    return instantiateFloatingRegister(pattern)
+
+
 # Actual work ================================================
 
 # register ===================================
 
-def register_i():
+def register(name, types):
     res = privateNamespacePrefix()
 
     res += '''
 template <std::size_t W>
-constexpr auto register_i_impl() {
-'''
+constexpr auto {}_impl() {{
+'''.format(name)
 
     res += ifConstexprPattern(
         'W == {}', 'return type_t<{}>{{}};',
-        [(128, '__m128i'), (256, '__m256i'), (512, '__m512i')]
+        list(zip([128, 256, 512], types))
     )
 
     res += '''
@@ -190,23 +228,41 @@ constexpr auto register_i_impl() {
 
     res += '''
 template <std::size_t W>
-using register_i = typename decltype(_mm::register_i_impl<W>())::type;
-'''
+using {0} = typename decltype(_mm::{0}_impl<W>())::type;
+'''.format(name)
 
     return res
 
 
+def register_i():
+    return register('register_i', ['__m128i', '__m256i', '__m512i'])
+
+
+def register_ps():
+    return register('register_ps', ['__m128', '__m256', '__m512'])
+
+
+def register_pd():
+    return register('register_pd', ['__m128d', '__m256d', '__m512d'])
+
+
 # sizes =====================================================
 
 def sizes():
     return '''
 template <typename Register>
 constexpr std::size_t bit_width() {
-  if constexpr (std::is_same_v<Register, register_i<128>>) {
+  if constexpr (std::is_same_v<Register, register_i<128>> ||
+                std::is_same_v<Register, register_ps<128>> ||
+                std::is_same_v<Register, register_pd<128>>) {
     return 128;
-  } else if constexpr (std::is_same_v<Register, register_i<256>>) {
+  } else if constexpr (std::is_same_v<Register, register_i<256>> ||
+                       std::is_same_v<Register, register_ps<256>> ||
+                       std::is_same_v<Register, register_pd<256>>) {
     return 256;
-  } else if constexpr (std::is_same_v<Register, register_i<512>>) {
+  } else if constexpr (std::is_same_v<Register, register_i<512>> ||
+                       std::is_same_v<Register, register_ps<512>> ||
+                       std::is_same_v<Register, register_pd<512>>) {
     return 512;
   }
   throw error_t{ };
@@ -262,6 +318,44 @@ inline void storeu(register_i<{0}>* addr, register_i<{0}> a) {{
 '''
     return instantiateJustRegister(pattern)
 
+def loadFloating():
+    pattern = '''
+__attribute__((no_sanitize_address))
+inline register_{2}<{0}> load(const register_{2}<{0}>* addr) {{
+  return _mm{1}_load_{2}(reinterpret_cast<const {3}*>(addr));
+}}
+'''
+    return instantiateFloatingRegister(pattern)
+
+
+def loaduFloating():
+    pattern = '''
+__attribute__((no_sanitize_address))
+inline register_{2}<{0}> loadu(const register_{2}<{0}>* addr) {{
+  return _mm{1}_loadu_{2}(reinterpret_cast<const {3}*>(addr));
+}}
+'''
+    return instantiateFloatingRegister(pattern)
+
+
+def storeFloating():
+    pattern = '''
+inline void store(register_{2}<{0}>* addr, register_{2}<{0}> a) {{
+  _mm{1}_store_{2}(reinterpret_cast<{3}*>(addr), a);
+}}
+'''
+    return instantiateFloatingRegister(pattern)
+
+
+def storeuFloating():
+    pattern = '''
+inline void storeu(register_{2}<{0}>* addr, register_{2}<{0}> a) {{
+  _mm{1}_storeu_{2}(reinterpret_cast<{3}*>(addr), a);
+}}
+'''
+    return instantiateFloatingRegister(pattern)
+
+
 def maskmoveu():
     return '''
 inline void maskmoveu(register_i<128>* addr, register_i<128> a, register_i<128> mask) {{
@@ -274,11 +368,13 @@ inline void maskmoveu(register_i<128>* addr, register_i<128> a, register_i<128>
 
 def set0():
     res = '''
-// Does not exist for floats.
 template <typename Register>
 inline auto setzero() {
   static constexpr std::size_t register_width = bit_width<Register>();
 '''
+    res += instantiateIfConstexprPattern_floating(
+        'std::is_same_v<Register, register_{2}<{0}>>',
+        'return _mm{1}_setzero_{2}();')
     return res + instantiateIfConstexprPattern_justRegister(
         'register_width == {0}',
         'return _mm{1}_setzero_si{0}();')
@@ -293,6 +389,11 @@ inline auto set1(T a) {
 
 '''
 
+    res += instantiateIfConstexprPattern_floating(
+        'register_width == {0} && std::is_same_v<T, {3}>',
+        'return _mm{1}_set1_{2}(a);'
+    )
+
     res += instantiateIfConstexprPattern_intWidth(
         'register_width == {0} && t_width == {2}',
         'return _mm{1}_set1_epi{2}((std::int{2}_t)a);'
@@ -315,6 +416,12 @@ inline auto min(Register a, Register b) {
 
 '''
 
+    # Floats have to go first: is_equivalent<float, std::int32_t>() is true.
+    res += instantiateIfConstexprPattern_floating(
+        'register_width == {0} && std::is_same_v<T, {3}>',
+        'return _mm{1}_min_{2}(a, b);'
+    )
+
     return res + instantiateIfConstexprPattern_intWidth_twice(
         'register_width == {0} && is_equivalent<T, std::int{2}_t>()',
         'return _mm{1}_min_epi{2}(a, b);',
@@ -331,6 +438,12 @@ inline auto max(Register a, Register b) {
 
 '''
 
+    # Floats have to go first: is_equivalent<float, std::int32_t>() is true.
+    res += instantiateIfConstexprPattern_floating(
+        'register_width == {0} && std::is_same_v<T, {3}>',
+        'return _mm{1}_max_{2}(a, b);'
+    )
+
     return res + instantiateIfConstexprPattern_intWidth_twice(
         'register_width == {0} && is_equivalent<T, std::int{2}_t>()',
         'return _mm{1}_max_epi{2}(a, b);',
@@ -349,9 +462,25 @@ def cmpeq():
     static constexpr std::size_t t_width = sizeof(T) * 8;
 '''
 
-    return res + instantiateIfConstexprPattern_intWidth(
+    res += ifConstexprChainOpen([
+        ('register_width == 128 && std::is_same_v<T, float>',
+         'return _mm_cmpeq_ps(a, b);'),
+        ('register_width == 128 && std::is_same_v<T, double>',
+         'return _mm_cmpeq_pd(a, b);'),
+        ('register_width == 256 && std::is_same_v<T, float>',
+         'return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);'),
+        ('register_width == 256 && std::is_same_v<T, double>',
+         'return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);'),
+        ('register_width == 512 && std::is_same_v<T, float>',
+         'return _mm512_movm_epi32(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ));'),
+        ('register_width == 512 && std::is_same_v<T, double>',
+         'return _mm512_movm_epi64(_mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ));'),
+    ])
+
+    return res + instantiateIfConstexprPattern_intWidth_avx512Mask(
         'register_width == {0} && t_width == {2}',
-        'return _mm{1}_cmpeq_epi{2}(a, b);'
+        'return _mm{1}_cmpeq_epi{2}(a, b);',
+        'return _mm{1}_movm_epi{2}(_mm{1}_cmpeq_epi{2}_mask(a, b));'
     )
 
 
@@ -363,9 +492,25 @@ def cmpgt():
     static constexpr std::size_t register_width = bit_width<Register>();
 '''
 
-    return res + instantiateIfConstexprPattern_intWidth(
+    res += ifConstexprChainOpen([
+        ('register_width == 128 && std::is_same_v<T, float>',
+         'return _mm_cmpgt_ps(a, b);'),
+        ('register_width == 128 && std::is_same_v<T, double>',
+         'return _mm_cmpgt_pd(a, b);'),
+        ('register_width == 256 && std::is_same_v<T, float>',
+         'return _mm256_cmp_ps(a, b, _CMP_GT_OQ);'),
+        ('register_width == 256 && std::is_same_v<T, double>',
+         'return _mm256_cmp_pd(a, b, _CMP_GT_OQ);'),
+        ('register_width == 512 && std::is_same_v<T, float>',
+         'return _mm512_movm_epi32(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ));'),
+        ('register_width == 512 && std::is_same_v<T, double>',
+         'return _mm512_movm_epi64(_mm512_cmp_pd_mask(a, b, _CMP_GT_OQ));'),
+    ])
+
+    return res + instantiateIfConstexprPattern_intWidth_avx512Mask(
         'register_width == {0} && is_equivalent<T, std::int{2}_t>()',
-        'return _mm{1}_cmpgt_epi{2}(a, b);'
+        'return _mm{1}_cmpgt_epi{2}(a, b);',
+        'return _mm{1}_movm_epi{2}(_mm{1}_cmpgt_epi{2}_mask(a, b));'
     )
 
 
@@ -379,6 +524,11 @@ def add():
     static constexpr std::size_t t_width = sizeof(T) * 8;
 '''
 
+    res += instantiateIfConstexprPattern_floating(
+        'register_width == {0} && std::is_same_v<T, {3}>',
+        'return _mm{1}_add_{2}(a, b);'
+    )
+
     return res + instantiateIfConstexprPattern_intWidth(
         'register_width == {0} && t_width == {2}',
         'return _mm{1}_add_epi{2}(a, b);'
@@ -393,6 +543,11 @@ def sub():
     static constexpr std::size_t t_width = sizeof(T) * 8;
 '''
 
+    res += instantiateIfConstexprPattern_floating(
+        'register_width == {0} && std::is_same_v<T, {3}>',
+        'return _mm{1}_sub_{2}(a, b);'
+    )
+
     return res + instantiateIfConstexprPattern_intWidth(
         'register_width == {0} && t_width == {2}',
         'return _mm{1}_sub_epi{2}(a, b);'
@@ -407,6 +562,10 @@ template <typename Register>
 inline auto and_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 '''
+    res += instantiateIfConstexprPattern_floating(
+        'std::is_same_v<Register, register_{2}<{0}>>',
+        'return _mm{1}_and_{2}(a, b);'
+    )
     return res + instantiateIfConstexprPattern_justRegister(
         'register_width == {0}',
         'return _mm{1}_and_si{0}(a, b);'
@@ -419,6 +578,10 @@ template <typename Register>
 inline auto or_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 '''
+    res += instantiateIfConstexprPattern_floating(
+        'std::is_same_v<Register, register_{2}<{0}>>',
+        'return _mm{1}_or_{2}(a, b);'
+    )
     return res + instantiateIfConstexprPattern_justRegister(
         'register_width == {0}',
         'return _mm{1}_or_si{0}(a, b);'
@@ -431,6 +594,10 @@ template <typename Register>
 inline auto xor_(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 '''
+    res += instantiateIfConstexprPattern_floating(
+        'std::is_same_v<Register, register_{2}<{0}>>',
+        'return _mm{1}_xor_{2}(a, b);'
+    )
     return res + instantiateIfConstexprPattern_justRegister(
         'register_width == {0}',
         'return _mm{1}_xor_si{0}(a, b);'
@@ -443,6 +610,10 @@ template <typename Register>
 inline auto andnot(Register a, Register b) {
   static constexpr std::size_t register_width = bit_width<Register>();
 '''
+    res += instantiateIfConstexprPattern_floating(
+        'std::is_same_v<Register, register_{2}<{0}>>',
+        'return _mm{1}_andnot_{2}(a, b);'
+    )
     return res + instantiateIfConstexprPattern_justRegister(
         'register_width == {0}',
         'return _mm{1}_andnot_si{0}(a, b);'
@@ -462,6 +633,8 @@ def movemask():
       return _mm_movemask_epi8(a);
     else if constexpr (register_width == 256 && t_width == 8)
       return _mm256_movemask_epi8(a);
+    else if constexpr (register_width == 512 && t_width == 8)
+      return _mm512_movepi8_mask(a);
     else return error_t{ };
   }
 '''
@@ -478,15 +651,56 @@ def blendv():
       return _mm_blendv_epi8(a, b, mask);
     else if constexpr (register_width == 256 && t_width == 8)
       return _mm256_blendv_epi8(a, b, mask);
+    else if constexpr (register_width == 512 && t_width == 8)
+      return _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b);
     else return error_t{ };
   }
 '''
 
+# casts =================================================
+
+def cast():
+    res = '''
+// Reinterprets bits between registers of the same width.
+template <typename To, typename From>
+inline auto cast(From a) {
+  static constexpr std::size_t register_width = bit_width<From>();
+  static_assert(register_width == bit_width<To>());
+
+  if constexpr (std::is_same_v<To, From>) return a;
+  else
+'''
+
+    casts = [
+        ('i', 'ps', '_mm{1}_castps_si{0}'),
+        ('i', 'pd', '_mm{1}_castpd_si{0}'),
+        ('ps', 'i', '_mm{1}_castsi{0}_ps'),
+        ('pd', 'i', '_mm{1}_castsi{0}_pd'),
+        ('ps', 'pd', '_mm{1}_castpd_ps'),
+        ('pd', 'ps', '_mm{1}_castps_pd'),
+    ]
+
+    pattern = ''.join(
+        ['if constexpr (std::is_same_v<To, register_' + to + '<{0}>> && '
+         'std::is_same_v<From, register_' + from_ + '<{0}>>)'
+         'return ' + intrinsic + '(a); else '
+         for to, from_, intrinsic in casts]
+    )
+
+    return res + instantiateJustRegister(pattern) + '  return error_t{}; }\n'
+
+
 def generateMainCode():
     res = ''
     res += section('register_i')
     res += register_i()
 
+    res += section('register_ps')
+    res += register_ps()
+
+    res += section('register_pd')
+    res += register_pd()
+
     res += section('sizes')
     res += sizes()
 
@@ -495,6 +709,10 @@ def generateMainCode():
     res += loadu()
     res += store()
     res += storeu()
+    res += loadFloating()
+    res += loaduFloating()
+    res += storeFloating()
+    res += storeuFloating()
     res += maskmoveu()
 
     res += section('set one value everywhere')
@@ -523,6 +741,9 @@ def generateMainCode():
     res += xor_()
     res += andnot()
 
+    res += section('casts')
+    res += cast()
+
     return res
 
 # Driver ==================================
@@ -42,8 +42,10 @@
 #include "simd/pack_detail/compress.h"
 
 #include "simd/pack_detail/shuffle.h"
+#include "simd/pack_detail/byte_set.h"
 
 #include "simd/pack_detail/reduce.h"
+#include "simd/pack_detail/scan.h"
 #include "simd/pack_detail/replace_ignored.h"
 
 #include "simd/pack_detail/to_array.h"
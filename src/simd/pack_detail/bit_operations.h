@@ -18,6 +18,7 @@
 #define SIMD_PACK_DETAIL_BIT_OPERATIONS_H_
 
 #include "simd/bits.h"
+#include "simd/pack_detail/pack_cast.h"
 #include "simd/pack_detail/pack_declaration.h"
 #include "simd/pack_detail/set.h"
 
@@ -45,9 +46,14 @@ pack<T, W> not_x_and_y(const pack<T, W>& x, const pack<T, W>& y) {
 
 template <typename T, std::size_t W>
 pack<T, W> not_(const pack<T, W>& x) {
-  using uscalar = unsigned_equivalent<T>;
-  const T FF = (T)all_ones<uscalar>();
-  return not_x_and_y(x, set_all<pack<T, W>>(FF));
+  if constexpr (std::is_floating_point_v<T>) {
+    // Can't get all ones in a float by converting.
+    return cast<pack<T, W>>(not_(cast_to_unsigned(x)));
+  } else {
+    using uscalar = unsigned_equivalent<T>;
+    const T FF = (T)all_ones<uscalar>();
+    return not_x_and_y(x, set_all<pack<T, W>>(FF));
+  }
 }
 
 }  // namespace simd
@@ -24,7 +24,12 @@ namespace simd {
 template <typename T, std::size_t W>
 pack<T, W> blend(const pack<T, W>& x, const pack<T, W>& y,
                  const vbool_t<pack<T, W>>& mask) {
-  return pack<T, W>{mm::blendv<std::uint8_t>(x.reg, y.reg, mask.reg)};
+  // Blending bytes works for every type, floats are just casted.
+  using reg_t = register_t<pack<T, W>>;
+  using mask_reg_t = register_t<vbool_t<pack<T, W>>>;
+
+  return pack<T, W>{mm::cast<reg_t>(mm::blendv<std::uint8_t>(
+      mm::cast<mask_reg_t>(x.reg), mm::cast<mask_reg_t>(y.reg), mask.reg))};
 }
 
 }  // namespace simd
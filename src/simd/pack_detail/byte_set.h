@@ -0,0 +1,134 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SIMD_PACK_DETAIL_BYTE_SET_H_
+#define SIMD_PACK_DETAIL_BYTE_SET_H_
+
+#include <array>
+#include <cstdint>
+
+#include "simd/pack_detail/bit_operations.h"
+#include "simd/pack_detail/comparisons_pairwise.h"
+#include "simd/pack_detail/operators.h"
+#include "simd/pack_detail/pack_declaration.h"
+#include "simd/pack_detail/set.h"
+
+namespace simd {
+namespace _byte_set {
+
+template <typename Register>
+Register shuffle_epi8(Register table, Register indexes) {
+  if constexpr (mm::bit_width<Register>() == 128) {
+    return _mm_shuffle_epi8(table, indexes);
+  } else if constexpr (mm::bit_width<Register>() == 256) {
+    return _mm256_shuffle_epi8(table, indexes);
+  } else {
+    return _mm512_shuffle_epi8(table, indexes);
+  }
+}
+
+template <typename Register>
+Register srli_epi16_4(Register x) {
+  if constexpr (mm::bit_width<Register>() == 128) {
+    return _mm_srli_epi16(x, 4);
+  } else if constexpr (mm::bit_width<Register>() == 256) {
+    return _mm256_srli_epi16(x, 4);
+  } else {
+    return _mm512_srli_epi16(x, 4);
+  }
+}
+
+template <typename Pack>
+Pack repeat_16_bytes(const std::array<std::uint8_t, 16>& bytes) {
+  const auto lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&bytes));
+  if constexpr (sizeof(Pack) == 16) {
+    return Pack{lane};
+  } else if constexpr (sizeof(Pack) == 32) {
+    return Pack{_mm256_broadcastsi128_si256(lane)};
+  } else {
+    return Pack{_mm512_broadcast_i32x4(lane)};
+  }
+}
+
+}  // namespace _byte_set
+
+// Like _mm_shuffle_epi8: for every byte of indexes take the byte from a
+// table, the table is 16 bytes repeated in every 128 bit lane.
+// If the index has the top bit set, the result is 0.
+template <std::size_t W>
+pack<std::uint8_t, W> lookup_16(const pack<std::uint8_t, W>& table,
+                                const pack<std::uint8_t, W>& indexes) {
+  return pack<std::uint8_t, W>{_byte_set::shuffle_epi8(table.reg, indexes.reg)};
+}
+
+// Membership test for an arbitrary set of bytes.
+// Based on: http://0x80.pl/articles/simd-byte-lookup.html (universal algorithm)
+//
+// The set is a 16x16 bit matrix: high nibble selects the row, low nibble
+// the column. Every column is split into 2 bytes: rows 0-7 and rows 8-15,
+// each one is looked up with a shuffle, the high nibble selects the bit.
+template <std::size_t W>
+class byte_set {
+  using pack = simd::pack<std::uint8_t, W>;
+  using vbool = vbool_t<pack>;
+
+  pack rows_0_7_;
+  pack rows_8_15_;
+  pack bit_for_row_;
+
+ public:
+  template <typename I>
+  // require InputIterator<I> && ValueType<I> is 1 byte
+  byte_set(I f, I l) {
+    std::array<std::uint8_t, 16> rows_0_7{};
+    std::array<std::uint8_t, 16> rows_8_15{};
+    std::array<std::uint8_t, 16> bit_for_row{};
+
+    for (; f != l; ++f) {
+      const auto byte = static_cast<std::uint8_t>(*f);
+      const std::uint8_t row = byte >> 4;
+      const std::uint8_t column = byte & 0xf;
+      auto& columns = row < 8 ? rows_0_7 : rows_8_15;
+      columns[column] |= static_cast<std::uint8_t>(1 << (row & 7));
+    }
+
+    for (std::uint8_t row = 0; row != 16; ++row) {
+      bit_for_row[row] = static_cast<std::uint8_t>(1 << (row & 7));
+    }
+
+    rows_0_7_ = _byte_set::repeat_16_bytes<pack>(rows_0_7);
+    rows_8_15_ = _byte_set::repeat_16_bytes<pack>(rows_8_15);
+    bit_for_row_ = _byte_set::repeat_16_bytes<pack>(bit_for_row);
+  }
+
+  vbool contains(const pack& bytes) const {
+    // Top bit set => 0 for rows 0-7. For rows 8-15 we flip the top bit.
+    const pack top_bit = set_all<pack>(0x80);
+    const pack column_0_7 = lookup_16(rows_0_7_, bytes);
+    const pack column_8_15 = lookup_16(rows_8_15_, bytes ^ top_bit);
+    const pack column = column_0_7 | column_8_15;
+
+    const pack rows =
+        pack{_byte_set::srli_epi16_4(bytes.reg)} & set_all<pack>(0xf);
+    const pack bit = lookup_16(bit_for_row_, rows);
+
+    return ~equal_pairwise(column & bit, set_zero<pack>());
+  }
+};
+
+}  // namespace simd
+
+#endif  // SIMD_PACK_DETAIL_BYTE_SET_H_
@@ -24,15 +24,19 @@
 
 namespace simd {
 
+// For floats comparisons return float registers, we cast them to vbool.
+
 template <typename T, std::size_t W>
 vbool_t<pack<T, W>> equal_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
-  return vbool_t<pack<T, W>>{mm::cmpeq<T>(x.reg, y.reg)};
+  using vbool = vbool_t<pack<T, W>>;
+  return vbool{mm::cast<register_t<vbool>>(mm::cmpeq<T>(x.reg, y.reg))};
 }
 
 template <typename T, std::size_t W>
 vbool_t<pack<T, W>> greater_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
   if constexpr (asif_signed_v<T>) {
-    return vbool_t<pack<T, W>>{mm::cmpgt<T>(x.reg, y.reg)};
+    using vbool = vbool_t<pack<T, W>>;
+    return vbool{mm::cast<register_t<vbool>>(mm::cmpgt<T>(x.reg, y.reg))};
   } else {
     // https://stackoverflow.com/a/33173643/5021064
 
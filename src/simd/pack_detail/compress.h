@@ -17,9 +17,12 @@
 #ifndef SIMD_PACK_DETAIL_COMPRESS_H_
 #define SIMD_PACK_DETAIL_COMPRESS_H_
 
+#include <algorithm>
+#include <array>
 #include <utility>
 
 #include "simd/pack_detail/compress_mask.h"
+#include "simd/pack_detail/pack_cast.h"
 #include "simd/pack_detail/pack_declaration.h"
 #include "simd/pack_detail/set.h"
 #include "simd/pack_detail/store.h"
@@ -30,8 +33,66 @@ namespace _compress {
 
 template <typename T, std::size_t W>
 std::pair<pack<T, W / 2>, pack<T, W / 2>> split(const pack<T, W>& x) {
-  return {{_mm256_extracti128_si256(x.reg, 0)},
-          {_mm256_extracti128_si256(x.reg, 1)}};
+  if constexpr (sizeof(x) == 64) {
+    return {{_mm512_extracti64x4_epi64(x.reg, 0)},
+            {_mm512_extracti64x4_epi64(x.reg, 1)}};
+  } else {
+    return {{_mm256_extracti128_si256(x.reg, 0)},
+            {_mm256_extracti128_si256(x.reg, 1)}};
+  }
+}
+
+template <typename T, std::size_t W>
+auto split_top_bits(top_bits<vbool_t<pack<T, W>>> mmask) {
+  using half_bits = top_bits<vbool_t<pack<T, W / 2>>>;
+  using half_raw = typename half_bits::raw_type;
+  constexpr std::uint32_t half_bytes = sizeof(pack<T, W>) / 2;
+
+  const auto top = mmask.raw & set_lower_n_bits(half_bytes);
+  const auto bottom = mmask.raw >> half_bytes;
+
+  return std::pair<half_bits, half_bits>{
+      half_bits{static_cast<half_raw>(top)},
+      half_bits{static_cast<half_raw>(bottom)}};
+}
+
+#ifdef __AVX512VBMI2__
+constexpr bool avx512_compress_small_types = true;
+#else
+constexpr bool avx512_compress_small_types = false;
+#endif
+
+// AVX-512 compress for chars and shorts requires VBMI2.
+template <typename T, std::size_t W>
+constexpr bool use_avx512_compress() {
+  return sizeof(pack<T, W>) == 64 &&
+         (sizeof(T) >= 4 || avx512_compress_small_types);
+}
+
+template <typename T>
+mm::register_i<512> maskz_compress(std::uint64_t mask, mm::register_i<512> x) {
+  if constexpr (sizeof(T) == 1) {
+    return _mm512_maskz_compress_epi8(mask, x);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm512_maskz_compress_epi16(static_cast<__mmask32>(mask), x);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), x);
+  } else {
+    return _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask), x);
+  }
+}
+
+template <typename T>
+void mask_compressstoreu(T* out, std::uint64_t mask, mm::register_i<512> x) {
+  if constexpr (sizeof(T) == 1) {
+    _mm512_mask_compressstoreu_epi8(out, mask, x);
+  } else if constexpr (sizeof(T) == 2) {
+    _mm512_mask_compressstoreu_epi16(out, static_cast<__mmask32>(mask), x);
+  } else if constexpr (sizeof(T) == 4) {
+    _mm512_mask_compressstoreu_epi32(out, static_cast<__mmask16>(mask), x);
+  } else {
+    _mm512_mask_compressstoreu_epi64(out, static_cast<__mmask8>(mask), x);
+  }
 }
 
 template <typename T, typename Register>
@@ -58,17 +119,29 @@ T* compress_store_unsafe(T* out, const pack<T, W>& x,
                          top_bits<vbool_t<pack<T, W>>> mmask) {
   using reg_t = register_t<pack<T, W>>;
 
-  if constexpr (mm::bit_width<reg_t>() == 256 && sizeof(T) >= 4) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using U = unsigned_equivalent<T>;
+    U* res = compress_store_unsafe(reinterpret_cast<U*>(out),
+                                   cast_to_unsigned(x), mmask);
+    return reinterpret_cast<T*>(res);
+  } else if constexpr (_compress::use_avx512_compress<T, W>()) {
+    // Compressing in a register and storing it is faster than
+    // compressing directly to memory.
+    auto [mask, offset] = compress_mask_for_avx512<T>(mmask.raw);
+    const reg_t compressed = _compress::maskz_compress<T>(mask, x.reg);
+    mm::storeu(reinterpret_cast<reg_t*>(out), compressed);
+    return out + offset;
+  } else if constexpr (mm::bit_width<reg_t>() == 256 && sizeof(T) >= 4) {
     auto [mask, offset] = compress_mask_for_permutevar8x32<T>(mmask.raw);
     const reg_t shuffled = _mm256_permutevar8x32_epi32(x.reg, mask);
     mm::storeu(reinterpret_cast<reg_t*>(out), shuffled);
     return out + offset;
-  } else if constexpr(mm::bit_width<reg_t>() == 256) {
+  } else if constexpr (mm::bit_width<reg_t>() >= 256) {
     auto [top, bottom] = _compress::split(x);
-    using half_bits = top_bits<vbool_t<pack<T, W / 2>>>;
+    auto [top_mmask, bottom_mmask] = _compress::split_top_bits<T, W>(mmask);
 
-    out = compress_store_unsafe(out, top, half_bits{mmask.raw & 0xffff});
-    return compress_store_unsafe(out, bottom, half_bits{mmask.raw >> 16});
+    out = compress_store_unsafe(out, top, top_mmask);
+    return compress_store_unsafe(out, bottom, bottom_mmask);
   } else {
     auto [mask, offset] = compress_mask_for_shuffle_epi8<T>(mmask.raw);
 
@@ -88,12 +161,21 @@ T* compress_store_masked(T* out, const pack<T, W>& x,
                          top_bits<vbool_t<pack<T, W>>> mmask) {
   using reg_t = register_t<pack<T, W>>;
 
-  if constexpr (mm::bit_width<reg_t>() == 256) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using U = unsigned_equivalent<T>;
+    U* res = compress_store_masked(reinterpret_cast<U*>(out),
+                                   cast_to_unsigned(x), mmask);
+    return reinterpret_cast<T*>(res);
+  } else if constexpr (_compress::use_avx512_compress<T, W>()) {
+    auto [mask, offset] = compress_mask_for_avx512<T>(mmask.raw);
+    _compress::mask_compressstoreu(out, mask, x.reg);
+    return out + offset;
+  } else if constexpr (mm::bit_width<reg_t>() >= 256) {
     auto [top, bottom] = _compress::split(x);
-    using half_bits = top_bits<vbool_t<pack<T, W / 2>>>;
+    auto [top_mmask, bottom_mmask] = _compress::split_top_bits<T, W>(mmask);
 
-    out = compress_store_masked(out, top, half_bits{mmask.raw & 0xffff});
-    return compress_store_masked(out, bottom, half_bits{mmask.raw >> 16});
+    out = compress_store_masked(out, top, top_mmask);
+    return compress_store_masked(out, bottom, bottom_mmask);
   } else {
     // We have to do this check, since we can't in the end distinguish between
     // just taking the first element and not taking any elements.
@@ -109,6 +191,23 @@ T* compress_store_masked(T* out, const pack<T, W>& x,
   }
 }
 
+// Does not access memory after the stored elements. compress_store_masked
+// doesn't change it, but maskmoveu still can touch it and fault if that's
+// not mapped. AVX-512 masked stores don't have this problem.
+template <typename T, std::size_t W>
+T* compress_store_exact(T* out, const pack<T, W>& x,
+                        top_bits<vbool_t<pack<T, W>>> mmask) {
+  if constexpr (_compress::use_avx512_compress<T, W>()) {
+    return compress_store_masked(out, x, mmask);
+  } else {
+    if (!mmask) return out;
+
+    alignas(pack<T, W>) std::array<T, W> buf;
+    T* buf_end = compress_store_unsafe(buf.data(), x, mmask);
+    return std::copy(buf.data(), buf_end, out);
+  }
+}
+
 }  // namespace simd
 
 #endif  // SIMD_PACK_DETAIL_COMPRESS_H_
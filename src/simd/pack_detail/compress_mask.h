@@ -72,6 +72,20 @@ inline std::pair<__m256i, std::uint8_t> mask256_epi32(std::uint32_t mmask) {
   return {expanded, offset};
 }
 
+// AVX-512 compress instructions take one bit per element.
+template <typename T>
+std::uint64_t element_mask(std::uint64_t mmask) {
+  if constexpr (sizeof(T) == 1) {
+    return mmask;
+  } else if constexpr (sizeof(T) == 2) {
+    return _pext_u64(mmask, 0x5555'5555'5555'5555);
+  } else if constexpr (sizeof(T) == 4) {
+    return _pext_u64(mmask, 0x1111'1111'1111'1111);
+  } else {
+    return _pext_u64(mmask, 0x0101'0101'0101'0101);
+  }
+}
+
 }  // namespace _compress_mask
 
 template <typename T>
@@ -91,6 +105,13 @@ std::pair<__m256i, std::uint8_t> compress_mask_for_permutevar8x32(
   return res;
 }
 
+template <typename T>
+std::pair<std::uint64_t, std::uint8_t> compress_mask_for_avx512(
+    std::uint64_t mmask) {
+  const std::uint64_t res = _compress_mask::element_mask<T>(mmask);
+  return {res, static_cast<std::uint8_t>(_mm_popcnt_u64(res))};
+}
+
 }  // namespace simd
 
 #endif  // SIMD_PACK_DETAIL_COMPRESS_MASK_H_
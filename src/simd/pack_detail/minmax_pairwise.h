@@ -22,9 +22,12 @@
 
 namespace simd {
 
+// NOTE: for floats we use min/max instructions, which
+// return the second argument if one of them is a NaN.
+
 template <typename T, std::size_t W>
 pack<T, W> min_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
- if constexpr (sizeof(T) < 8) {
+  if constexpr (sizeof(T) < 8 || std::is_floating_point_v<T>) {
     return pack<T, W>{mm::min<T>(x.reg, y.reg)};
   } else {
     // blend: if true take second.
@@ -34,7 +37,7 @@ pack<T, W> min_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
 
 template <typename T, std::size_t W>
 pack<T, W> max_pairwise(const pack<T, W>& x, const pack<T, W>& y) {
-  if constexpr (sizeof(T) < 8) {
+  if constexpr (sizeof(T) < 8 || std::is_floating_point_v<T>) {
     return pack<T, W>{mm::max<T>(x.reg, y.reg)};
   } else {
     // blend: if true take second.
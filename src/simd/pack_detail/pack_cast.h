@@ -26,8 +26,7 @@ namespace simd {
 
 template <typename Pack, typename T, std::size_t W>
 Pack cast(const pack<T, W>& x) {
-  static_assert(std::is_same_v<register_t<Pack>, register_t<pack<T, W>>>);
-  return Pack{x.reg};
+  return Pack{mm::cast<register_t<Pack>>(x.reg)};
 }
 
 template <typename U, typename T, std::size_t W>
@@ -30,17 +30,35 @@ auto select_unsigned_equivalent_type() {
   if constexpr (std::is_pointer_v<T>) {
     static_assert(sizeof(T) == sizeof(std::uint64_t));
     return std::uint64_t{};
+  } else if constexpr (std::is_same_v<T, float>) {
+    return std::uint32_t{};
+  } else if constexpr (std::is_same_v<T, double>) {
+    return std::uint64_t{};
   } else {
     return std::make_unsigned_t<T>{};
   }
 }
 
+template <typename T, std::size_t W>
+auto select_register_type() {
+  constexpr std::size_t bit_width = W * sizeof(T) * 8;
+
+  if constexpr (std::is_same_v<T, float>) {
+    return mm::register_ps<bit_width>{};
+  } else if constexpr (std::is_same_v<T, double>) {
+    return mm::register_pd<bit_width>{};
+  } else {
+    return mm::register_i<bit_width>{};
+  }
+}
+
 }  // namespace _pack_declaration
 
 template <typename T, std::size_t W>
 struct pack {
   // Type properties ==============
-  using register_type = mm::register_i<W * sizeof(T) * 8>;
+  using register_type =
+      decltype(_pack_declaration::select_register_type<T, W>());
 
   using vbool_type =
       pack<decltype(_pack_declaration::select_unsigned_equivalent_type<T>()),
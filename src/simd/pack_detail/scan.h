@@ -0,0 +1,54 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SIMD_PACK_DETAIL_SCAN_H_
+#define SIMD_PACK_DETAIL_SCAN_H_
+
+#include "simd/pack_detail/pack_declaration.h"
+#include "simd/pack_detail/shuffle.h"
+
+namespace simd {
+namespace _scan {
+
+// log(W) steps, every one adds the element `shift` positions before:
+//
+// [0, 1, 2, 3] + [_, 0, 1, 2] =
+//    [0, 0 + 1, 1 + 2, 2 + 3]
+// [0, 0 + 1, 1 + 2, 2 + 3] + [_, _, 0, 0 + 1] =
+//    [0, 0 + 1, 0 + 1 + 2, 0 + 1 + 2 + 3]
+
+template <std::size_t shift, typename T, std::size_t W, typename Op>
+pack<T, W> inclusive_scan_impl(pack<T, W> x, Op op) {
+  x = op(x, shift_elements_right<shift>(x));
+  if constexpr (shift * 2 >= W) {
+    return x;
+  } else {
+    return inclusive_scan_impl<shift * 2>(x, op);
+  }
+}
+
+}  // namespace _scan
+
+// Zeroes are shifted in, so op(x, zeroes) has to be x.
+template <typename T, std::size_t W, typename Op>
+// require BinaryTransformation<Op, pack<T, W>>
+pack<T, W> inclusive_scan(const pack<T, W>& x, Op op) {
+  return _scan::inclusive_scan_impl<1>(x, op);
+}
+
+}  // namespace simd
+
+#endif  // SIMD_PACK_DETAIL_SCAN_H_
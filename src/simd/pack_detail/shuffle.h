@@ -18,6 +18,7 @@
 #define SIMD_PACK_DETAIL_SHUFFLE_H
 
 #include <array>
+#include <cstdint>
 
 #include "simd/pack_detail/pack_declaration.h"
 
@@ -34,15 +35,27 @@ inline mm::register_i<256> swap_adjacent_32_bytes_mask() {
                           swap_adjacent_16_bytes_mask());
 }
 
+inline mm::register_i<512> swap_adjacent_64_bytes_mask() {
+  return _mm512_broadcast_i32x4(swap_adjacent_16_bytes_mask());
+}
+
 template <std::size_t byte_width, typename Register>
 Register swap_adjacent(Register x) {
   static constexpr auto two_elements_4_parts_shuffle = _MM_SHUFFLE(1, 0, 3, 2);
   static constexpr auto four_element_shuffle = _MM_SHUFFLE(2, 3, 0, 1);
 
+  // AVX-512 takes an enum for epi32 shuffles.
+  static constexpr auto two_elements_4_parts_perm =
+      static_cast<_MM_PERM_ENUM>(two_elements_4_parts_shuffle);
+  static constexpr auto four_element_perm =
+      static_cast<_MM_PERM_ENUM>(four_element_shuffle);
+
   if constexpr (byte_width == 1 && mm::bit_width<Register>() == 128) {
     return _mm_shuffle_epi8(x, swap_adjacent_16_bytes_mask());
   } else if constexpr (byte_width == 1 && mm::bit_width<Register>() == 256) {
     return _mm256_shuffle_epi8(x, swap_adjacent_32_bytes_mask());
+  } else if constexpr (byte_width == 1 && mm::bit_width<Register>() == 512) {
+    return _mm512_shuffle_epi8(x, swap_adjacent_64_bytes_mask());
   } else if constexpr (byte_width == 2 && mm::bit_width<Register>() == 128) {
     // Optimized to one load + shuffle
     x = _mm_shufflehi_epi16(x, four_element_shuffle);
@@ -51,26 +64,183 @@ Register swap_adjacent(Register x) {
     // Optimized to one load + shuffle
     x = _mm256_shufflehi_epi16(x, four_element_shuffle);
     return _mm256_shufflelo_epi16(x, four_element_shuffle);
+  } else if constexpr (byte_width == 2 && mm::bit_width<Register>() == 512) {
+    x = _mm512_shufflehi_epi16(x, four_element_shuffle);
+    return _mm512_shufflelo_epi16(x, four_element_shuffle);
   } else if constexpr (byte_width == 4 && mm::bit_width<Register>() == 128) {
     return _mm_shuffle_epi32(x, four_element_shuffle);
   } else if constexpr (byte_width == 4 && mm::bit_width<Register>() == 256) {
     return _mm256_shuffle_epi32(x, four_element_shuffle);
+  } else if constexpr (byte_width == 4 && mm::bit_width<Register>() == 512) {
+    return _mm512_shuffle_epi32(x, four_element_perm);
   } else if constexpr (byte_width == 8 && mm::bit_width<Register>() == 128) {
     return _mm_shuffle_epi32(x, two_elements_4_parts_shuffle);
   } else if constexpr (byte_width == 8 && mm::bit_width<Register>() == 256) {
     return _mm256_permute4x64_epi64(x, four_element_shuffle);
+  } else if constexpr (byte_width == 8 && mm::bit_width<Register>() == 512) {
+    return _mm512_shuffle_epi32(x, two_elements_4_parts_perm);
   } else if constexpr (byte_width == 16 && mm::bit_width<Register>() == 256) {
     return _mm256_permute4x64_epi64(x, two_elements_4_parts_shuffle);
+  } else if constexpr (byte_width == 16 && mm::bit_width<Register>() == 512) {
+    // Works within 256 bit lanes.
+    return _mm512_permutex_epi64(x, two_elements_4_parts_shuffle);
+  } else if constexpr (byte_width == 32 && mm::bit_width<Register>() == 512) {
+    return _mm512_shuffle_i64x2(x, x, two_elements_4_parts_shuffle);
   } else {
     return error_t{};
   }
 }
 
+template <std::size_t dwords>
+__m512i shift_dwords_right_512(__m512i x) {
+  if constexpr (dwords == 0) {
+    return x;
+  } else if constexpr (dwords >= 16) {
+    return _mm512_setzero_si512();
+  } else {
+    return _mm512_alignr_epi32(x, _mm512_setzero_si512(), 16 - dwords);
+  }
+}
+
+// Moves bytes towards the end of the register, first ones are zeroes.
+// For 256 and 512 bits shifts within 128 bit lanes have to get the bytes
+// from the previous lane.
+template <std::size_t byte_shift, typename Register>
+Register shift_bytes_right(Register x) {
+  static_assert(0 < byte_shift && byte_shift < mm::bit_width<Register>() / 8);
+
+  if constexpr (mm::bit_width<Register>() == 128) {
+    return _mm_slli_si128(x, byte_shift);
+  } else if constexpr (mm::bit_width<Register>() == 256) {
+    // Low lane: zeroes, high lane: low lane of x.
+    const Register previous_lane = _mm256_permute2x128_si256(x, x, 0x08);
+    if constexpr (byte_shift < 16) {
+      return _mm256_alignr_epi8(x, previous_lane, 16 - byte_shift);
+    } else if constexpr (byte_shift == 16) {
+      return previous_lane;
+    } else {
+      return _mm256_slli_si256(previous_lane, byte_shift - 16);
+    }
+  } else {
+    // valignd shifts the whole register, but only by 4 bytes.
+    constexpr std::size_t dwords = byte_shift / 4;
+    constexpr std::size_t rest = byte_shift % 4;
+
+    const Register shifted = shift_dwords_right_512<dwords>(x);
+    if constexpr (rest == 0) {
+      return shifted;
+    } else {
+      const Register previous_lane = shift_dwords_right_512<dwords + 4>(x);
+      return _mm512_alignr_epi8(shifted, previous_lane, 16 - rest);
+    }
+  }
+}
+
+template <std::size_t dwords>
+__m512i rotate_dwords_right_512(__m512i x) {
+  if constexpr (dwords % 16 == 0) {
+    return x;
+  } else {
+    return _mm512_alignr_epi32(x, x, 16 - dwords % 16);
+  }
+}
+
+// Same as shift_bytes_right but the bytes from the end go to the beginning.
+template <std::size_t byte_shift, typename Register>
+Register rotate_bytes_right(Register x) {
+  static_assert(0 < byte_shift && byte_shift < mm::bit_width<Register>() / 8);
+
+  if constexpr (mm::bit_width<Register>() == 128) {
+    return _mm_alignr_epi8(x, x, 16 - byte_shift);
+  } else if constexpr (mm::bit_width<Register>() == 256) {
+    const Register swapped_lanes = _mm256_permute2x128_si256(x, x, 0x01);
+    if constexpr (byte_shift < 16) {
+      return _mm256_alignr_epi8(x, swapped_lanes, 16 - byte_shift);
+    } else if constexpr (byte_shift == 16) {
+      return swapped_lanes;
+    } else {
+      return _mm256_alignr_epi8(swapped_lanes, x, 32 - byte_shift);
+    }
+  } else {
+    constexpr std::size_t dwords = byte_shift / 4;
+    constexpr std::size_t rest = byte_shift % 4;
+
+    const Register rotated = rotate_dwords_right_512<dwords>(x);
+    if constexpr (rest == 0) {
+      return rotated;
+    } else {
+      const Register previous_lane = rotate_dwords_right_512<dwords + 4>(x);
+      return _mm512_alignr_epi8(rotated, previous_lane, 16 - rest);
+    }
+  }
+}
+
+// Copies the last sizeof(T) bytes of the register everywhere.
+template <std::size_t byte_width, typename Register>
+Register broadcast_last(Register x) {
+  // Every 128 bit lane: take the last element of the high 8 bytes.
+  std::array<std::uint8_t, 16> mask_bytes;
+  for (std::size_t i = 0; i != 16; ++i) {
+    mask_bytes[i] = static_cast<std::uint8_t>(16 - byte_width + i % byte_width);
+  }
+  const __m128i mask =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_bytes.data()));
+
+  if constexpr (mm::bit_width<Register>() == 128) {
+    return _mm_shuffle_epi8(x, mask);
+  } else if constexpr (mm::bit_width<Register>() == 256) {
+    x = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm256_shuffle_epi8(x, _mm256_broadcastsi128_si256(mask));
+  } else {
+    x = _mm512_permutexvar_epi64(_mm512_set1_epi64(7), x);
+    return _mm512_shuffle_epi8(x, _mm512_broadcast_i32x4(mask));
+  }
+}
+
 }  // namespace _shuffle
 
 template <std::size_t group_size, typename T, std::size_t W>
 pack<T, W> swap_adjacent_groups(const pack<T, W>& x) {
-  return pack<T, W>{_shuffle::swap_adjacent<group_size * sizeof(T)>(x.reg)};
+  // Shuffles are done on integer registers.
+  using reg_t = register_t<pack<T, W>>;
+  using int_reg_t = register_t<vbool_t<pack<T, W>>>;
+
+  const auto shuffled = _shuffle::swap_adjacent<group_size * sizeof(T)>(
+      mm::cast<int_reg_t>(x.reg));
+  return pack<T, W>{mm::cast<reg_t>(shuffled)};
+}
+
+// Element i becomes x[i - n], first n elements are zeroes.
+template <std::size_t n, typename T, std::size_t W>
+pack<T, W> shift_elements_right(const pack<T, W>& x) {
+  using reg_t = register_t<pack<T, W>>;
+  using int_reg_t = register_t<vbool_t<pack<T, W>>>;
+
+  const auto shifted = _shuffle::shift_bytes_right<n * sizeof(T)>(
+      mm::cast<int_reg_t>(x.reg));
+  return pack<T, W>{mm::cast<reg_t>(shifted)};
+}
+
+// Element i becomes x[(i - n) % W].
+template <std::size_t n, typename T, std::size_t W>
+pack<T, W> rotate_elements_right(const pack<T, W>& x) {
+  using reg_t = register_t<pack<T, W>>;
+  using int_reg_t = register_t<vbool_t<pack<T, W>>>;
+
+  const auto rotated = _shuffle::rotate_bytes_right<n * sizeof(T)>(
+      mm::cast<int_reg_t>(x.reg));
+  return pack<T, W>{mm::cast<reg_t>(rotated)};
+}
+
+// All elements are equal to the last one.
+template <typename T, std::size_t W>
+pack<T, W> broadcast_last(const pack<T, W>& x) {
+  using reg_t = register_t<pack<T, W>>;
+  using int_reg_t = register_t<vbool_t<pack<T, W>>>;
+
+  const auto res =
+      _shuffle::broadcast_last<sizeof(T)>(mm::cast<int_reg_t>(x.reg));
+  return pack<T, W>{mm::cast<reg_t>(res)};
 }
 
 }  // namespace simd
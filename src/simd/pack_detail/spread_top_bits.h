@@ -72,6 +72,11 @@ inline __m256i spread_8_ints(std::uint32_t mmask) {
   return _mm256_cmpeq_epi32(bits_for_bytes, isolated);
 }
 
+// AVX-512 has this as an instruction.
+inline __m512i spread_64_chars(std::uint64_t mmask) {
+  return _mm512_movm_epi8(mmask);
+}
+
 }  // namespace _spread_top_bits
 
 template <typename Pack>
@@ -86,6 +91,8 @@ Pack spread_top_bits(top_bits<Pack> mmask) {
     } else {
       return Pack{_spread_top_bits::spread_16_chars(mmask_raw)};
     }
+  } else if constexpr (mm::bit_width<reg_t>() == 512) {
+    return Pack{_spread_top_bits::spread_64_chars(mmask.raw)};
   } else {
     if constexpr (sizeof(scalar) >= 4) {
       return Pack{_spread_top_bits::spread_8_ints(mmask.raw)};
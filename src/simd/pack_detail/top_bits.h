@@ -18,15 +18,21 @@
 #define SIMD_PACK_DETAIL_TOP_BITS_H_
 
 #include <optional>
+#include <type_traits>
 
 #include "simd/bits.h"
 #include "simd/pack_detail/pack_declaration.h"
 
 namespace simd {
 
+// One bit per byte, like movemask. For 512 bit registers that's 64 bits,
+// same as AVX-512 mask registers.
 template <typename Pack>
 struct top_bits {
-  std::uint32_t raw;
+  using raw_type =
+      std::conditional_t<sizeof(Pack) == 64, std::uint64_t, std::uint32_t>;
+
+  raw_type raw;
 
   explicit operator bool() const { return raw; }
 
@@ -79,8 +85,15 @@ struct top_bits {
 
 template <typename Pack>
 top_bits<Pack> get_top_bits(const Pack& x) {
+  using raw_type = typename top_bits<Pack>::raw_type;
+
+  const auto bytes = mm::cast<register_t<vbool_t<Pack>>>(x.reg);
+  const auto mmask = mm::movemask<std::uint8_t>(bytes);
+
+  // movemask returns int for 128/256 bits, should not sign extend.
+  using unsigned_mmask = std::make_unsigned_t<decltype(mmask)>;
   return top_bits<Pack>{
-      static_cast<std::uint32_t>(mm::movemask<std::uint8_t>(x.reg))};
+      static_cast<raw_type>(static_cast<unsigned_mmask>(mmask))};
 }
 
 template <typename Pack>
@@ -91,12 +104,15 @@ top_bits<Pack> get_top_bits(const Pack& x, top_bits<Pack> ignore) {
 
 template <typename Pack>
 top_bits<Pack> ignore_first_n_mask() {
-  return top_bits<Pack>{set_lower_n_bits(sizeof(Pack))};
+  using raw_type = typename top_bits<Pack>::raw_type;
+  return top_bits<Pack>{set_lower_n_bits<raw_type>(sizeof(Pack))};
 }
 
 template <typename Pack>
 top_bits<Pack> ignore_first_n_mask(std::uint32_t n) {
-  return top_bits<Pack>{~set_lower_n_bits(n * sizeof(scalar_t<Pack>))};
+  using raw_type = typename top_bits<Pack>::raw_type;
+  return top_bits<Pack>{
+      ~set_lower_n_bits<raw_type>(n * sizeof(scalar_t<Pack>))};
 }
 
 template <typename Pack>
@@ -116,8 +132,9 @@ top_bits<Pack> ignore_last_n_mask() {
 
 template <typename Pack>
 top_bits<Pack> ignore_last_n_mask(std::uint32_t n) {
+  using raw_type = typename top_bits<Pack>::raw_type;
   return top_bits<Pack>{
-      set_lower_n_bits(sizeof(Pack) - n * sizeof(scalar_t<Pack>))};
+      set_lower_n_bits<raw_type>(sizeof(Pack) - n * sizeof(scalar_t<Pack>))};
 }
 
 template <typename Pack>
@@ -146,9 +163,19 @@ std::optional<std::uint32_t> first_true(const top_bits<Pack>& x) {
   return count_trailing_zeroes(x.raw) / sizeof(scalar_t<Pack>);
 }
 
+// Bits outside of the pack (after ~ for example) are not counted.
+template <typename Pack>
+std::uint32_t count_true(const top_bits<Pack>& x) {
+  using raw_type = typename top_bits<Pack>::raw_type;
+  const raw_type in_pack = x.raw & set_lower_n_bits<raw_type>(sizeof(Pack));
+  return static_cast<std::uint32_t>(popcount(in_pack)) /
+         sizeof(scalar_t<Pack>);
+}
+
 template <typename Pack>
 bool all_true(const top_bits<Pack>& x) {
-  return x.raw == set_lower_n_bits(sizeof(Pack));
+  using raw_type = typename top_bits<Pack>::raw_type;
+  return x.raw == set_lower_n_bits<raw_type>(sizeof(Pack));
 }
 
 }  // namespace simd
@@ -108,6 +108,12 @@ void min_test() {
 
   bc.reserve(3);
   run(bc);
+
+  bc.add(3);
+  bc.add(2);
+  bc.clear();
+  REQUIRE(bc.reduce() == -1);
+  REQUIRE(bc.end() - bc.begin() >= 2);
 }
 
 template <template <typename...> class Bc>
@@ -125,5 +131,14 @@ TEST_CASE("algorithm.binary_counter_fixed", "[algorithm]") {
   binary_counter_test<binary_counter_to_16>();
 }
 
+TEST_CASE("algorithm.binary_counter", "[algorithm]") {
+  binary_counter_test<binary_counter>();
+
+  binary_counter<min> bc{min{}, -1};
+  for (int i = 1000; i; --i) bc.add(i);
+  REQUIRE(bc.reduce() == 1);
+  REQUIRE(bc.significant_digits().second - bc.begin() == 10);
+}
+
 }  // namespace
 }  // namespace algo
@@ -16,6 +16,10 @@
 
 #include "algo/binary_search.h"
 
+#include <algorithm>
+#include <forward_list>
+#include <vector>
+
 #include "test/catch.h"
 
 #include "test/algo/binary_search_generic_test.h"
@@ -34,5 +38,107 @@ TEST_CASE("algorithm.binary_search.lower_bound_n", "[algorithm]") {
   });
 }
 
+TEST_CASE("algorithm.binary_search.lower_bound_n_counting", "[algorithm]") {
+  test_lower_bound_n_counting([](auto f, auto n, const auto& v) {
+    return algo::lower_bound_n_counting(f, n, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.partition_point_n_counting",
+          "[algorithm]") {
+  for (int size = 0; size != 50; ++size) {
+    for (int pp = 0; pp <= size; ++pp) {
+      std::forward_list<int> l(size);
+      std::fill(std::next(l.begin(), pp), l.end(), 1);
+
+      auto is_zero = [](int x) { return x == 0; };
+      auto [found, rank] =
+          algo::partition_point_n_counting(l.begin(), size, is_zero);
+      REQUIRE(found == std::next(l.begin(), pp));
+      REQUIRE(rank == pp);
+    }
+  }
+}
+
+TEST_CASE("algorithm.binary_search.upper_bound", "[algorithm]") {
+  test_upper_bound(
+      [](auto f, auto l, const auto& v) { return algo::upper_bound(f, l, v); });
+}
+
+TEST_CASE("algorithm.binary_search.upper_bound_n", "[algorithm]") {
+  test_upper_bound_n([](auto f, auto n, const auto& v) {
+    return algo::upper_bound_n(f, n, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.equal_range", "[algorithm]") {
+  test_equal_range(
+      [](auto f, auto l, const auto& v) { return algo::equal_range(f, l, v); });
+}
+
+TEST_CASE("algorithm.binary_search.equal_range_n", "[algorithm]") {
+  test_equal_range_n([](auto f, auto n, const auto& v) {
+    return algo::equal_range_n(f, n, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.equal_range_n_long_runs", "[algorithm]") {
+  for (int size = 0; size != 100; ++size) {
+    for (int run = 1; run != 40; run += 3) {
+      std::vector<int> v(size);
+      for (int i = 0; i != size; ++i) v[i] = i / run;
+
+      for (int x = -1; x <= size / run + 1; ++x) {
+        REQUIRE(algo::equal_range_n(v.begin(), size, x) ==
+                std::equal_range(v.begin(), v.end(), x));
+      }
+    }
+  }
+}
+
+TEST_CASE("algorithm.binary_search.partition_point_n_branchless",
+          "[algorithm]") {
+  for (int size = 0; size != 50; ++size) {
+    for (int pp = 0; pp <= size; ++pp) {
+      std::vector<int> v(size);
+      std::fill(v.begin() + pp, v.end(), 1);
+
+      auto is_zero = [](int x) { return x == 0; };
+      REQUIRE(algo::partition_point_n_branchless(v.begin(), size, is_zero) ==
+              v.begin() + pp);
+    }
+  }
+}
+
+TEST_CASE("algorithm.binary_search.lower_bound_batch", "[algorithm]") {
+  // Duplicates and keys not in the range.
+  std::vector<int> keys;
+  for (int i = -1; i != 60; ++i) keys.push_back(i % 2 ? 60 - i : i);
+
+  for (int size = 0; size != 100; ++size) {
+    std::vector<int> v(size);
+    for (int i = 0; i != size; ++i) v[i] = i / 2;
+
+    using I = std::vector<int>::iterator;
+
+    std::vector<I> expected;
+    for (int key : keys) {
+      expected.push_back(std::lower_bound(v.begin(), v.end(), key));
+    }
+
+    std::vector<I> actual(keys.size());
+    REQUIRE(algo::lower_bound_batch(v.begin(), v.end(), keys.begin(),
+                                    keys.end(), actual.begin()) ==
+            actual.end());
+    REQUIRE(expected == actual);
+
+    // Less than a group.
+    actual.assign(3, v.end());
+    algo::lower_bound_batch(v.begin(), v.end(), keys.begin(),
+                            keys.begin() + 3, actual.begin());
+    REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin()));
+  }
+}
+
 }  // namespace
 }  // namespace algo
@@ -48,5 +48,29 @@ TEST_CASE("algorithm.binary_search.lower_bound_hinted", "[algorithm]") {
   });
 }
 
+TEST_CASE("algorithm.binary_search.upper_bound_biased", "[algorithm]") {
+  test_upper_bound([](auto f, auto l, const auto& v) {
+    return algo::upper_bound_biased(f, l, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.upper_bound_hinted", "[algorithm]") {
+  test_upper_bound_hinted([](auto f, auto h, auto l, const auto& v) {
+    return algo::upper_bound_hinted(f, h, l, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.equal_range_biased", "[algorithm]") {
+  test_equal_range([](auto f, auto l, const auto& v) {
+    return algo::equal_range_biased(f, l, v);
+  });
+}
+
+TEST_CASE("algorithm.binary_search.equal_range_hinted", "[algorithm]") {
+  test_equal_range_hinted([](auto f, auto h, auto l, const auto& v) {
+    return algo::equal_range_hinted(f, h, l, v);
+  });
+}
+
 }  // namespace
 }  // namespace algo
@@ -21,6 +21,7 @@
 #include <array>
 #include <list>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "algo/container_cast.h"
@@ -78,6 +79,18 @@ void test_lower_bound_n(Alg alg) {
       [](auto f, auto l, const auto& v) { return std::lower_bound(f, l, v); });
 }
 
+template <typename Alg>
+void test_lower_bound_n_counting(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto, auto l, const auto& v) {
+        return alg(f, std::distance(f, l), v);
+      },
+      [](auto f, auto l, const auto& v) {
+        auto found = std::lower_bound(f, l, v);
+        return std::make_pair(found, std::distance(f, found));
+      });
+}
+
 template <typename Alg>
 void test_lower_bound_hinted(Alg alg) {
     detail::binary_search_generic_test_impl::test_any_binary_search(
@@ -86,6 +99,52 @@ void test_lower_bound_hinted(Alg alg) {
     );
 }
 
+template <typename Alg>
+void test_upper_bound(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto, auto l, const auto& v) { return alg(f, l, v); },
+      [](auto f, auto l, const auto& v) { return std::upper_bound(f, l, v); });
+}
+
+template <typename Alg>
+void test_upper_bound_n(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto, auto l, const auto& v) {
+        return alg(f, std::distance(f, l), v);
+      },
+      [](auto f, auto l, const auto& v) { return std::upper_bound(f, l, v); });
+}
+
+template <typename Alg>
+void test_upper_bound_hinted(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto h, auto l, const auto& v) { return alg(f, h, l, v); },
+      [](auto f, auto l, const auto& v) { return std::upper_bound(f, l, v); });
+}
+
+template <typename Alg>
+void test_equal_range(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto, auto l, const auto& v) { return alg(f, l, v); },
+      [](auto f, auto l, const auto& v) { return std::equal_range(f, l, v); });
+}
+
+template <typename Alg>
+void test_equal_range_n(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto, auto l, const auto& v) {
+        return alg(f, std::distance(f, l), v);
+      },
+      [](auto f, auto l, const auto& v) { return std::equal_range(f, l, v); });
+}
+
+template <typename Alg>
+void test_equal_range_hinted(Alg alg) {
+  detail::binary_search_generic_test_impl::test_any_binary_search(
+      [&](auto f, auto h, auto l, const auto& v) { return alg(f, h, l, v); },
+      [](auto f, auto l, const auto& v) { return std::equal_range(f, l, v); });
+}
+
 }  // namespace algo
 
 #endif  // TEST_BINARY_SEARCH_GENERIC_TEST_H
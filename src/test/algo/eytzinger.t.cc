@@ -0,0 +1,60 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "algo/eytzinger.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+void eytzinger_test(const std::vector<int>& sorted) {
+  const eytzinger<int> layout(sorted.begin(), sorted.end());
+  REQUIRE(layout.size() == sorted.size());
+
+  const int max = sorted.empty() ? 0 : sorted.back();
+  for (int v = -1; v <= max + 1; ++v) {
+    const auto expected = static_cast<std::size_t>(
+        std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+    REQUIRE(expected == layout.lower_bound(v));
+  }
+}
+
+TEST_CASE("algorithm.eytzinger", "[algorithm]") {
+  for (int size = 0; size != 300; ++size) {
+    std::vector<int> unique(size);
+    for (int i = 0; i != size; ++i) unique[i] = 2 * i;
+    eytzinger_test(unique);
+
+    std::vector<int> duplicates(size);
+    for (int i = 0; i != size; ++i) duplicates[i] = i / 3;
+    eytzinger_test(duplicates);
+  }
+
+  std::vector<int> big(100'000);
+  for (int i = 0; i != static_cast<int>(big.size()); ++i) big[i] = i;
+  eytzinger_test(big);
+
+  // Default constructed is empty.
+  REQUIRE(eytzinger<int>{}.lower_bound(1) == 0);
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/finger_search.h"
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "test/algo/binary_search_generic_test.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.finger_search.seek", "[algorithm]") {
+  test_lower_bound_hinted([](auto f, auto h, auto l, const auto& v) {
+    finger_search<decltype(f)> cursor(f, l);
+    if (h != l) cursor.seek(*h);
+    return cursor.seek(v);
+  });
+}
+
+template <typename C>
+void seek_all_test(const C& data, const std::vector<int>& keys) {
+  using I = typename C::const_iterator;
+
+  std::vector<I> expected;
+  for (int key : keys) {
+    expected.push_back(std::lower_bound(data.begin(), data.end(), key));
+  }
+
+  std::vector<I> actual(keys.size());
+  finger_search<I> cursor(data.begin(), data.end());
+  REQUIRE(cursor.seek_all(keys.begin(), keys.end(), actual.begin()) ==
+          actual.end());
+  REQUIRE(expected == actual);
+}
+
+TEST_CASE("algorithm.finger_search.seek_all", "[algorithm]") {
+  std::mt19937 g;
+
+  for (int size = 0; size != 100; ++size) {
+    std::vector<int> data(size);
+    for (int i = 0; i != size; ++i) data[i] = i / 2 * 3;
+    std::list<int> data_list(data.begin(), data.end());
+
+    std::uniform_int_distribution<int> dis(-1, size * 3 / 2 + 1);
+    std::vector<int> keys(50);
+    for (auto& key : keys) key = dis(g);
+
+    seek_all_test(data, keys);
+    seek_all_test(data_list, keys);
+
+    std::sort(keys.begin(), keys.end());
+    seek_all_test(data, keys);
+    seek_all_test(data_list, keys);
+
+    // Mostly increasing with steps back.
+    for (std::size_t i = 7; i < keys.size(); i += 8) {
+      std::swap(keys[i - 3], keys[i]);
+    }
+    seek_all_test(data, keys);
+    seek_all_test(data_list, keys);
+  }
+
+  std::vector<int> empty_keys;
+  seek_all_test(std::vector<int>{1, 2, 3}, empty_keys);
+}
+
+TEST_CASE("algorithm.finger_search.custom_comparator", "[algorithm]") {
+  std::vector<int> data{9, 7, 7, 5, 3, 1};
+  finger_search<std::vector<int>::iterator, std::greater<>> cursor(
+      data.begin(), data.end(), std::greater<>{});
+
+  REQUIRE(cursor.seek(7) == data.begin() + 1);
+  REQUIRE(cursor.seek(2) == data.begin() + 5);
+  REQUIRE(cursor.finger() == data.begin() + 5);
+  REQUIRE(cursor.seek(10) == data.begin());
+  REQUIRE(cursor.seek(0) == data.end());
+}
+
+}  // namespace
+}  // namespace algo
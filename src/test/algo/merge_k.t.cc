@@ -0,0 +1,201 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/merge_k.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+
+namespace algo {
+namespace {
+
+using tagged = std::pair<int, int>;
+
+// Second is the index of the run, so std::stable_sort by first gives
+// the expected stable merge.
+template <template <typename...> class C>
+void merge_k_test(const std::vector<std::vector<int>>& runs) {
+  std::vector<C<tagged>> tagged_runs;
+  std::vector<tagged> expected;
+  for (std::size_t i = 0; i != runs.size(); ++i) {
+    C<tagged> run;
+    for (int x : runs[i]) run.push_back({x, static_cast<int>(i)});
+    expected.insert(expected.end(), run.begin(), run.end());
+    tagged_runs.push_back(std::move(run));
+  }
+  std::stable_sort(expected.begin(), expected.end(), less_by_first{});
+
+  using I = typename C<tagged>::const_iterator;
+  std::vector<std::pair<I, I>> ranges;
+  for (const auto& run : tagged_runs) ranges.emplace_back(run.begin(), run.end());
+
+  std::vector<tagged> actual;
+  merge_k(ranges, std::back_inserter(actual), less_by_first{});
+  REQUIRE(expected == actual);
+}
+
+void merge_k_test(const std::vector<std::vector<int>>& runs) {
+  merge_k_test<std::vector>(runs);
+  merge_k_test<std::list>(runs);
+}
+
+std::vector<int> sorted_random_run(std::mt19937& g, std::size_t size,
+                                   int max_value) {
+  std::uniform_int_distribution<int> dis(0, max_value);
+  std::vector<int> res(size);
+  for (auto& x : res) x = dis(g);
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+TEST_CASE("algorithm.merge_k", "[algorithm]") {
+  merge_k_test({});
+  merge_k_test({{}});
+  merge_k_test({{1, 2, 3}});
+  merge_k_test({{}, {1, 1}, {}});
+  merge_k_test({{1, 3, 5}, {2, 4, 6}});
+  merge_k_test({{1, 1, 1}, {1, 1}, {1}});
+
+  std::mt19937 g;
+  std::uniform_int_distribution<std::size_t> size_dis(0, 50);
+
+  for (std::size_t k = 1; k != 20; ++k) {
+    for (int max_value : {3, 1000}) {
+      std::vector<std::vector<int>> runs;
+      for (std::size_t i = 0; i != k; ++i) {
+        runs.push_back(sorted_random_run(g, size_dis(g), max_value));
+      }
+      merge_k_test(runs);
+    }
+  }
+}
+
+TEST_CASE("algorithm.merge_k.one_run_dominates", "[algorithm]") {
+  std::mt19937 g;
+
+  for (std::size_t k : {2, 3, 8, 17}) {
+    for (std::size_t big : {std::size_t(0), k / 2, k - 1}) {
+      std::vector<std::vector<int>> runs;
+      for (std::size_t i = 0; i != k; ++i) {
+        runs.push_back(sorted_random_run(g, i == big ? 1000 : 5, 100));
+      }
+      merge_k_test(runs);
+    }
+  }
+
+  // Long stretches of the same run, without interleaving.
+  std::vector<std::vector<int>> runs(4);
+  for (int i = 0; i != 400; ++i) runs[(i / 50) % 4].push_back(i);
+  merge_k_test(runs);
+}
+
+TEST_CASE("algorithm.merge_k.default_comparator", "[algorithm]") {
+  std::vector<int> a{1, 4, 7}, b{2, 5, 8}, c{3, 6, 9};
+  std::vector<std::pair<std::vector<int>::iterator, std::vector<int>::iterator>>
+      ranges{{a.begin(), a.end()}, {b.begin(), b.end()}, {c.begin(), c.end()}};
+
+  std::vector<int> out(9);
+  REQUIRE(merge_k(ranges, out.begin()) == out.end());
+  REQUIRE(out == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+// Small integers with std::less are merged with packed nodes.
+template <typename T>
+void merge_k_integers_test() {
+  std::mt19937 g;
+  std::uniform_int_distribution<long long> dis(std::numeric_limits<T>::min(),
+                                               std::numeric_limits<T>::max());
+
+  for (std::size_t k : {1, 2, 3, 8, 33}) {
+    std::vector<std::vector<T>> runs(k);
+    std::vector<T> expected;
+    for (auto& run : runs) {
+      run.resize(k * 3);
+      for (auto& x : run) x = static_cast<T>(dis(g) % 5 ? dis(g) : 0);
+      run.push_back(std::numeric_limits<T>::min());
+      run.push_back(std::numeric_limits<T>::max());
+      std::sort(run.begin(), run.end());
+      expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::sort(expected.begin(), expected.end());
+
+    using I = typename std::vector<T>::const_iterator;
+    std::vector<std::pair<I, I>> ranges;
+    for (const auto& run : runs) ranges.emplace_back(run.begin(), run.end());
+
+    std::vector<T> actual(expected.size());
+    REQUIRE(merge_k(ranges, actual.begin(), std::less<>{}) == actual.end());
+    REQUIRE(expected == actual);
+  }
+}
+
+TEST_CASE("algorithm.merge_k.integers", "[algorithm]") {
+  merge_k_integers_test<int>();
+  merge_k_integers_test<unsigned>();
+  merge_k_integers_test<short>();
+  merge_k_integers_test<std::uint8_t>();
+  merge_k_integers_test<std::int8_t>();
+}
+
+// Not trivially copyable - heads are stored by pointer.
+TEST_CASE("algorithm.merge_k.strings", "[algorithm]") {
+  std::vector<std::vector<std::string>> runs{
+      {"a", "c", "e"}, {"b", "d"}, {}, {"a", "f", "g"}};
+  using I = std::vector<std::string>::const_iterator;
+  std::vector<std::pair<I, I>> ranges;
+  for (const auto& run : runs) ranges.emplace_back(run.begin(), run.end());
+
+  std::vector<std::string> actual;
+  merge_k(ranges, std::back_inserter(actual));
+  REQUIRE(actual == std::vector<std::string>{"a", "a", "b", "c", "d", "e", "f",
+                                             "g"});
+}
+
+// Trivially copyable but not default constructible - stored by pointer.
+struct no_default {
+  explicit no_default(int x) : value(x) {}
+  int value;
+
+  friend bool operator<(no_default x, no_default y) {
+    return x.value < y.value;
+  }
+};
+
+TEST_CASE("algorithm.merge_k.not_default_constructible", "[algorithm]") {
+  std::vector<no_default> a{no_default(1), no_default(3)};
+  std::vector<no_default> b{no_default(2)};
+  using I = std::vector<no_default>::const_iterator;
+  std::vector<std::pair<I, I>> ranges{{a.begin(), a.end()},
+                                      {b.begin(), b.end()}};
+
+  std::vector<no_default> actual;
+  merge_k(ranges, std::back_inserter(actual));
+  REQUIRE(actual.size() == 3u);
+  for (int i = 0; i != 3; ++i) REQUIRE(actual[i].value == i + 1);
+}
+
+}  // namespace
+}  // namespace algo
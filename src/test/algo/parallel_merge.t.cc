@@ -0,0 +1,116 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/parallel_merge.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algorithm.parallel_merge.merge_path_split", "[algorithm]") {
+  for (int n1 = 0; n1 != 10; ++n1) {
+    for (int n2 = 0; n2 != 10; ++n2) {
+      // Lots of duplicates between the ranges.
+      std::vector<int> xs(n1), ys(n2);
+      for (int i = 0; i != n1; ++i) xs[i] = i / 2;
+      for (int i = 0; i != n2; ++i) ys[i] = i / 3;
+
+      // Second is 1 for elements of the first range.
+      std::vector<std::pair<int, int>> tagged_xs, tagged_ys, merged;
+      for (int x : xs) tagged_xs.emplace_back(x, 1);
+      for (int y : ys) tagged_ys.emplace_back(y, 0);
+      std::merge(tagged_xs.begin(), tagged_xs.end(), tagged_ys.begin(),
+                 tagged_ys.end(), std::back_inserter(merged), less_by_first{});
+
+      int expected = 0;
+      for (int d = 0; d <= n1 + n2; ++d) {
+        REQUIRE(detail::merge_path_split(xs.begin(), n1, ys.begin(), n2, d,
+                                         std::less<>{}) == expected);
+        if (d != n1 + n2) expected += merged[d].second;
+      }
+    }
+  }
+}
+
+void parallel_merge_test(thread_pool& pool, std::size_t n1, std::size_t n2,
+                         int max_value) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, max_value);
+
+  std::vector<int> xs_values(n1), ys_values(n2);
+  for (auto& x : xs_values) x = dis(g);
+  for (auto& y : ys_values) y = dis(g);
+  std::sort(xs_values.begin(), xs_values.end());
+  std::sort(ys_values.begin(), ys_values.end());
+
+  // Second is which range the element is from, to check stability.
+  std::vector<std::pair<int, int>> xs, ys;
+  for (int x : xs_values) xs.emplace_back(x, 1);
+  for (int y : ys_values) ys.emplace_back(y, 2);
+
+  std::vector<std::pair<int, int>> expected(n1 + n2);
+  std::merge(xs.begin(), xs.end(), ys.begin(), ys.end(), expected.begin(),
+             less_by_first{});
+
+  std::vector<std::pair<int, int>> actual(n1 + n2);
+  REQUIRE(parallel_merge(pool, xs.begin(), xs.end(), ys.begin(), ys.end(),
+                         actual.begin(), less_by_first{}) == actual.end());
+  REQUIRE(expected == actual);
+}
+
+TEST_CASE("algorithm.parallel_merge", "[algorithm]") {
+  const std::size_t cutoff = parallel_merge_cutoff;
+
+  for (std::size_t n_threads : {1, 2, 3, 8}) {
+    thread_pool pool(n_threads);
+
+    for (std::size_t n1 : {std::size_t(0), std::size_t(10), cutoff,
+                           3 * cutoff + 7}) {
+      for (std::size_t n2 : {std::size_t(0), std::size_t(1), cutoff + 1}) {
+        parallel_merge_test(pool, n1, n2, 10);
+        parallel_merge_test(pool, n1, n2, 1'000'000);
+      }
+    }
+  }
+}
+
+TEST_CASE("algorithm.parallel_merge.default_comparator", "[algorithm]") {
+  thread_pool pool(4);
+
+  std::vector<int> xs(50'000), ys(30'000);
+  for (std::size_t i = 0; i != xs.size(); ++i) xs[i] = static_cast<int>(i * 3);
+  for (std::size_t i = 0; i != ys.size(); ++i) ys[i] = static_cast<int>(i * 5);
+
+  std::vector<int> expected(xs.size() + ys.size());
+  std::merge(xs.begin(), xs.end(), ys.begin(), ys.end(), expected.begin());
+
+  std::vector<int> actual(expected.size());
+  parallel_merge(pool, xs.begin(), xs.end(), ys.begin(), ys.end(),
+                 actual.begin());
+  REQUIRE(expected == actual);
+}
+
+}  // namespace
+}  // namespace algo
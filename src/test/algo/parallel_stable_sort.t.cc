@@ -0,0 +1,81 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/parallel_stable_sort.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+
+#include "algo/comparisons.h"
+#include "test/algo/stability_test_util.h"
+
+namespace algo {
+namespace {
+
+void parallel_stable_sort_test(thread_pool& pool, std::size_t size,
+                               int max_value) {
+  static std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, max_value);
+
+  std::vector<int> values(size);
+  for (auto& x : values) x = dis(g);
+
+  const auto input = make_container_of_stable_unique_iota<std::vector>(values);
+
+  auto expected = copy_container_of_stable_unique(input);
+  std::stable_sort(expected.begin(), expected.end(), less_by_first{});
+
+  auto actual = copy_container_of_stable_unique(input);
+  parallel_stable_sort(pool, actual.begin(), actual.end(), less_by_first{});
+
+  REQUIRE(expected == actual);
+}
+
+TEST_CASE("algorithm.parallel_stable_sort", "[algorithm]") {
+  const std::size_t cutoff = parallel_stable_sort_cutoff;
+
+  for (std::size_t n_threads : {1, 2, 3, 8}) {
+    thread_pool pool(n_threads);
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(100),
+                             cutoff, cutoff + 1, 3 * cutoff + 7}) {
+      // Lots of duplicates to check stability and no duplicates.
+      parallel_stable_sort_test(pool, size, 10);
+      parallel_stable_sort_test(pool, size, static_cast<int>(size) * 10);
+    }
+  }
+}
+
+TEST_CASE("algorithm.parallel_stable_sort.default_comparator",
+          "[algorithm]") {
+  thread_pool pool(4);
+
+  std::vector<int> v(100'000);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    v[i] = static_cast<int>((i * 7919) % v.size());
+  }
+
+  parallel_stable_sort(pool, v.begin(), v.end());
+  REQUIRE(std::is_sorted(v.begin(), v.end()));
+  REQUIRE(v.front() == 0);
+  REQUIRE(v.back() == static_cast<int>(v.size()) - 1);
+}
+
+}  // namespace
+}  // namespace algo
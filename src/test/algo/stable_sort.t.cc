@@ -16,6 +16,8 @@
 
 #include "algo/stable_sort.h"
 
+#include <memory>
+
 #include "test/catch.h"
 
 #include "test/algo/stable_sort_generic_test.h"
@@ -23,6 +25,25 @@
 namespace algo {
 namespace {
 
+long allocations_count = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    ++allocations_count;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
 TEST_CASE("algorithm.stable_sort_sufficient_allocation", "[algorithm]") {
   stable_sort_test([](auto... params) {
     algo::stable_sort_sufficient_allocation(params...);
@@ -35,6 +56,53 @@ TEST_CASE("algorithm.stable_sort_sufficient_allocation_std_merge", "[algorithm]"
   });
 }
 
+TEST_CASE("algorithm.stable_sort_natural", "[algorithm]") {
+  stable_sort_test([](auto... params) {
+    algo::stable_sort_natural(params...);
+  });
+}
+
+TEST_CASE("algorithm.stable_sort_bottom_up", "[algorithm]") {
+  stable_sort_test([](auto... params) {
+    algo::stable_sort_bottom_up(params...);
+  });
+}
+
+TEST_CASE("algorithm.stable_sorter", "[algorithm]") {
+  stable_sorter<int> sorter(std::less<>{}, 3);
+
+  auto run = [&](int n) {
+    std::vector<int> expected;
+    for (int i = n; i; --i) {
+      sorter.push_back(i % 7);
+      expected.push_back(i % 7);
+    }
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(sorter.sorted() == expected);
+  };
+
+  for (int n : {0, 1, 3, 4, 100, 1000, 5}) run(n);
+}
+
+TEST_CASE("algorithm.stable_sorter.reuses_buffers", "[algorithm]") {
+  for (std::size_t block_size : {3, 16, 1024}) {
+    stable_sorter<int, std::less<>, counting_allocator<int>> sorter(
+        std::less<>{}, block_size);
+
+    auto batch = [&] {
+      for (int i = 10000; i; --i) sorter.push_back(i % 1000);
+      auto& res = sorter.sorted();
+      REQUIRE(res.size() == 10000u);
+      REQUIRE(std::is_sorted(res.begin(), res.end()));
+    };
+
+    batch();
+    const long before = allocations_count;
+    batch();
+    REQUIRE(allocations_count == before);
+  }
+}
+
 TEST_CASE("algorithm.stable_sort_lifting", "[algorithm]") {
   stable_sort_test([](auto... params) {
     algo::stable_sort_lifting(params...);
@@ -109,9 +109,38 @@ struct stable_sort_generic_test_impl {
     }
   }
 
+  // Runs that are already there: sorted, reversed, sorted with appended
+  // elements, few sorted chunks.
+  template <typename Sorter>
+  void test_presorted(Sorter sorter) {
+    for (size_t size : {size_t(31), size_t(32), size_t(33), size_t(1000),
+                        static_cast<size_t>(big_reasonable_size)}) {
+      auto t = random_vector(size);
+      std::sort(t.begin(), t.end());
+      run_test(t, sorter);
+
+      std::reverse(t.begin(), t.end());
+      run_test(t, sorter);
+
+      std::sort(t.begin(), t.end());
+      auto tail = random_vector(size / 10);
+      std::copy(tail.begin(), tail.end(), t.end() - tail.size());
+      run_test(t, sorter);
+
+      for (size_t chunk : {size / 7 + 1, size / 2 + 1}) {
+        t = random_vector(size);
+        for (size_t i = 0; i < size; i += chunk) {
+          std::sort(t.begin() + i, t.begin() + std::min(size, i + chunk));
+        }
+        run_test(t, sorter);
+      }
+    }
+  }
+
   template <typename Sorter>
   void run(Sorter sorter) {
     special_cases(sorter);
+    test_presorted(sorter);
     test_small_permutations(sorter);
     test_rather_big_ranges(sorter);
   }
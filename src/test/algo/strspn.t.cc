@@ -0,0 +1,86 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/strspn.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+template <std::size_t width>
+struct strspn_functors {
+  std::size_t strspn(const char* s, const char* accept) const {
+    return algo::strspn<width>(s, accept);
+  }
+
+  std::size_t strcspn(const char* s, const char* reject) const {
+    return algo::strcspn<width>(s, reject);
+  }
+
+  const char* strpbrk(const char* s, const char* accept) const {
+    return algo::strpbrk<width>(s, accept);
+  }
+};
+
+#define ALL_WIDTH (strspn_functors<16>), (strspn_functors<32>)
+
+TEMPLATE_TEST_CASE("algo.simd.strings.strspn", "[algo][simd][strspn]",
+                   ALL_WIDTH) {
+  TestType selected;
+
+  std::mt19937 g;
+  std::uniform_int_distribution<char> dis('a', 'h');
+
+  auto make_string = [&](std::size_t size) mutable {
+    std::string res(size, 'a');
+    std::generate(res.begin(), res.end(), [&]() mutable { return dis(g); });
+    return res;
+  };
+
+  const char* sets[] = {"", "a", "abc", "\x80\xff", "bcdefg", "abcdefgh"};
+
+  for (std::size_t size = 0; size < 128; ++size) {
+    const std::string s = make_string(size);
+    for (std::size_t offset : {0, 1, 5}) {
+      if (offset > size) continue;
+      const char* x = s.c_str() + offset;
+
+      for (const char* set : sets) {
+        REQUIRE(selected.strspn(x, set) == std::strspn(x, set));
+        REQUIRE(selected.strcspn(x, set) == std::strcspn(x, set));
+        REQUIRE(selected.strpbrk(x, set) == std::strpbrk(x, set));
+      }
+    }
+  }
+
+  // More than a page
+  {
+    std::string s(5000, 'a');
+    s += "b,";
+    REQUIRE(selected.strspn(s.c_str(), "a") == 5000);
+    REQUIRE(selected.strcspn(s.c_str(), ",") == 5001);
+    REQUIRE(selected.strpbrk(s.c_str(), ",b") == s.c_str() + 5000);
+    REQUIRE(selected.strpbrk(s.c_str(), "c") == nullptr);
+  }
+}
+
+}  // namespace
+}  // namespace algo
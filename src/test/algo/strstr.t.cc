@@ -0,0 +1,85 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/strstr.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+template <std::size_t width>
+struct strstr_functor {
+  const char* operator()(const char* s, const char* needle) const {
+    return algo::strstr<width>(s, needle);
+  }
+};
+
+#define ALL_WIDTH (strstr_functor<16>), (strstr_functor<32>)
+
+TEMPLATE_TEST_CASE("algo.simd.strings.strstr", "[algo][simd][strstr]",
+                   ALL_WIDTH) {
+  TestType selected_strstr;
+
+  REQUIRE(selected_strstr("", "") == std::strstr("", ""));
+  REQUIRE(selected_strstr("", "a") == nullptr);
+
+  std::mt19937 g;
+  std::uniform_int_distribution<char> dis('a', 'c');
+
+  auto make_string = [&](std::size_t size) mutable {
+    std::string res(size, 'a');
+    std::generate(res.begin(), res.end(), [&]() mutable { return dis(g); });
+    return res;
+  };
+
+  for (std::size_t size = 0; size < 128; ++size) {
+    const std::string s = make_string(size);
+    for (std::size_t m = 0; m < 10; ++m) {
+      const std::string needle = make_string(m);
+      for (std::size_t offset : {0, 1, 5}) {
+        if (offset > size) continue;
+        const char* x = s.c_str() + offset;
+        REQUIRE(selected_strstr(x, needle.c_str()) ==
+                std::strstr(x, needle.c_str()));
+      }
+    }
+
+    // Needle at the end.
+    for (std::size_t m = 1; m <= size; m += 3) {
+      const char* needle = s.c_str() + size - m;
+      REQUIRE(selected_strstr(s.c_str(), needle) ==
+              std::strstr(s.c_str(), needle));
+    }
+  }
+
+  // More than a page
+  {
+    std::string s(5000, 'a');
+    s += "ab";
+    REQUIRE(selected_strstr(s.c_str(), "ab") == s.c_str() + 5000);
+    REQUIRE(selected_strstr(s.c_str(), "abc") == nullptr);
+    REQUIRE(selected_strstr(s.c_str(), std::string(4000, 'a').c_str()) ==
+            s.c_str());
+  }
+}
+
+}  // namespace
+}  // namespace algo
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "algo/thread_pool.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "test/catch.h"
+
+namespace algo {
+namespace {
+
+TEST_CASE("algo.thread_pool", "[algo][thread_pool]") {
+  REQUIRE(thread_pool::default_size() >= 1);
+
+  for (std::size_t n_threads : {1, 2, 3, 8}) {
+    thread_pool pool(n_threads);
+    REQUIRE(pool.size() == n_threads);
+
+    // Reused between calls.
+    for (std::size_t n : {0, 1, 2, 7, 100, 1000}) {
+      std::vector<int> visited(n, 0);
+      pool.for_each_index(n, [&](std::size_t i) { ++visited[i]; });
+      REQUIRE(visited == std::vector<int>(n, 1));
+    }
+  }
+}
+
+TEST_CASE("algo.thread_pool.uses_threads", "[algo][thread_pool]") {
+  thread_pool pool(4);
+
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  std::atomic<int> arrived{0};
+
+  // Every index waits for all of the others, so it has to be 4 threads.
+  pool.for_each_index(4, [&](std::size_t) {
+    {
+      std::lock_guard lock{mutex};
+      ids.insert(std::this_thread::get_id());
+    }
+    ++arrived;
+    while (arrived != 4) std::this_thread::yield();
+  });
+
+  REQUIRE(ids.size() == 4u);
+  REQUIRE(ids.count(std::this_thread::get_id()) == 1u);
+}
+
+}  // namespace
+}  // namespace algo
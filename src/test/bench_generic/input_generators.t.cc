@@ -16,6 +16,7 @@
 
 #include "bench_generic/input_generators.h"
 
+#include <algorithm>
 #include <array>
 
 #include "test/catch.h"
@@ -114,6 +115,14 @@ TEST_CASE("bench.input_generators.generate_unique_sorted_vector", "[bench]") {
   }
 }
 
+TEST_CASE("bench.input_generators.sorted_list", "[bench]") {
+  auto v = sorted_vector<int>(100);
+  auto l = sorted_list<int>(100);
+
+  REQUIRE(l.size() == 100u);
+  REQUIRE(std::equal(l.begin(), l.end(), v.begin(), v.end()));
+}
+
 TEST_CASE("bench.input_generators.nth_vector_permutation", "[bench]") {
   {
     auto ints = nth_vector_permutation<int>(10, 0);
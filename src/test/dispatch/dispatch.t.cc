@@ -0,0 +1,135 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dispatch/dispatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dispatch/functions.h"
+#include "test/catch.h"
+
+namespace dispatch {
+namespace {
+
+std::vector<isa> supported_isas() {
+  std::vector<isa> res;
+  for (isa x : {isa::generic, isa::sse4_2, isa::avx2, isa::avx512}) {
+    if (is_supported(x)) res.push_back(x);
+  }
+  return res;
+}
+
+template <typename T>
+void typed_functions_test(const typed_functions<T>& fs) {
+  REQUIRE(fs.find);
+  REQUIRE(fs.remove);
+  REQUIRE(fs.reduce);
+
+  std::vector<T> v(200);
+
+  for (std::size_t size = 0; size < v.size(); ++size) {
+    T* f = v.data();
+    T* l = f + size;
+
+    std::fill(f, l, T(1));
+    REQUIRE(fs.reduce(f, l) == static_cast<T>(size));
+
+    std::iota(f, l, T(1));
+    for (std::size_t i = 0; i < size; i += 7) {
+      REQUIRE(fs.find(f, l, f[i]) == f + i);
+    }
+    REQUIRE(fs.find(f, l, T(0)) == l);
+
+    for (std::size_t i = 0; i < size; i += 3) f[i] = T(0);
+    std::vector<T> expected(f, l);
+    expected.erase(std::remove(expected.begin(), expected.end(), T(0)),
+                   expected.end());
+
+    T* removed = fs.remove(f, l, T(0));
+    REQUIRE(std::vector<T>(f, removed) == expected);
+  }
+}
+
+void string_functions_test(const functions& fs) {
+  REQUIRE(fs.strlen);
+  REQUIRE(fs.strcmp);
+
+  auto sign = [](int x) { return (x > 0) - (x < 0); };
+
+  std::mt19937 g;
+  std::uniform_int_distribution<char> dis('a', 'c');
+
+  for (std::size_t size = 0; size < 200; ++size) {
+    std::string x(size, 'a');
+    std::generate(x.begin(), x.end(), [&] { return dis(g); });
+    std::string y = x;
+
+    REQUIRE(fs.strlen(x.c_str()) == size);
+    REQUIRE(fs.strcmp(x.c_str(), y.c_str()) == 0);
+
+    if (size == 0) continue;
+
+    y[size / 2] = 'b';
+    REQUIRE(sign(fs.strcmp(x.c_str(), y.c_str())) ==
+            sign(std::strcmp(x.c_str(), y.c_str())));
+  }
+}
+
+TEST_CASE("dispatch.isa", "[dispatch]") {
+  REQUIRE(is_supported(isa::generic));
+  REQUIRE(is_supported(selected_isa()));
+
+  for (isa x : {isa::generic, isa::sse4_2, isa::avx2, isa::avx512}) {
+    if (!is_supported(x)) continue;
+    REQUIRE(x <= selected_isa());
+  }
+
+  REQUIRE(std::string("avx2") == isa_name(isa::avx2));
+}
+
+TEST_CASE("dispatch.functions_for", "[dispatch]") {
+  for (isa x : supported_isas()) {
+    INFO(isa_name(x));
+    const functions& fs = functions_for(x);
+
+    std::apply([](const auto&... typed) { (typed_functions_test(typed), ...); },
+               fs.typed);
+    string_functions_test(fs);
+  }
+}
+
+TEST_CASE("dispatch.selected", "[dispatch]") {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+
+  REQUIRE(dispatch::find(v.data(), v.data() + v.size(), 500) == v.data() + 500);
+  REQUIRE(dispatch::reduce(v.data(), v.data() + v.size()) == 999 * 500);
+
+  int* removed = dispatch::remove(v.data(), v.data() + v.size(), 0);
+  REQUIRE(removed == v.data() + v.size() - 1);
+  REQUIRE(v[0] == 1);
+
+  REQUIRE(dispatch::strlen("abc") == 3u);
+  REQUIRE(dispatch::strcmp("abc", "abd") < 0);
+}
+
+}  // namespace
+}  // namespace dispatch
@@ -34,11 +34,37 @@ TEST_CASE("bits.lsb_less", "[simd]") {
   REQUIRE(lsb_less(5u, 3u));  // 0101 0011
 }
 
+TEST_CASE("bits.count_leading_zeroes", "[simd]") {
+  REQUIRE(31 == count_leading_zeroes(1u));
+  REQUIRE(29 == count_leading_zeroes(5u));
+  REQUIRE(0 == count_leading_zeroes(0xffff'ffffu));
+
+  REQUIRE(63 == count_leading_zeroes(std::uint64_t{1}));
+  REQUIRE(31 == count_leading_zeroes(std::uint64_t{0x1'ffff'ffff}));
+  REQUIRE(0 == count_leading_zeroes(std::uint64_t{0xffff'ffff'ffff'ffff}));
+}
+
+TEST_CASE("bits.popcount", "[simd]") {
+  REQUIRE(0 == popcount(0u));
+  REQUIRE(1 == popcount(1u));
+  REQUIRE(2 == popcount(5u));
+  REQUIRE(32 == popcount(0xffff'ffffu));
+
+  REQUIRE(0 == popcount(std::uint64_t{0}));
+  REQUIRE(33 == popcount(std::uint64_t{0x1'ffff'ffff}));
+  REQUIRE(64 == popcount(std::uint64_t{0xffff'ffff'ffff'ffff}));
+}
+
 TEST_CASE("bits.set_lower_n_bits", "[simd]") {
   REQUIRE(0 == set_lower_n_bits(0));
   REQUIRE(1 == set_lower_n_bits(1));
   REQUIRE(3 == set_lower_n_bits(2));
   REQUIRE(0xffffffff == set_lower_n_bits(32));
+
+  REQUIRE(0 == set_lower_n_bits<std::uint64_t>(0));
+  REQUIRE(0xffffffff == set_lower_n_bits<std::uint64_t>(32));
+  REQUIRE(0x1'ffff'ffff == set_lower_n_bits<std::uint64_t>(33));
+  REQUIRE(0xffff'ffff'ffff'ffff == set_lower_n_bits<std::uint64_t>(64));
 }
 
 TEST_CASE("bits.set_highest_4_bits", "[simd]") {
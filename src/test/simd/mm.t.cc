@@ -50,6 +50,10 @@ struct test_256 {
 TEST_CASE("simd.mm.type", "[simd]") {
   is_same_test(register_i<128>{}, __m128i{});
   is_same_test(register_i<256>{}, __m256i{});
+  is_same_test(register_ps<128>{}, __m128{});
+  is_same_test(register_ps<256>{}, __m256{});
+  is_same_test(register_pd<128>{}, __m128d{});
+  is_same_test(register_pd<256>{}, __m256d{});
 }
 
 TEST_CASE("simd.mm.sizes", "[simd]") {
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <array>
 #include <numeric>
+#include <vector>
 
 #include <iostream>
 
@@ -31,6 +32,21 @@ template <typename T>
 void is_same_test(T, T) {}
 
 // clang-format off
+#ifdef __AVX512BW__
+#define AVX512_TEST_PACKS                               \
+  , (pack<std::int8_t, 64>), (pack<std::uint8_t, 64>),  \
+  (pack<std::int16_t, 32>),  (pack<std::uint16_t, 32>), \
+  (pack<std::int32_t, 16>),  (pack<std::uint32_t, 16>), \
+  (pack<std::int64_t, 8>),   (pack<std::uint64_t, 8>),  \
+  (pack<const int*, 8>)
+
+#define AVX512_FLOATING_TEST_PACKS \
+  , (pack<float, 16>), (pack<double, 8>)
+#else
+#define AVX512_TEST_PACKS
+#define AVX512_FLOATING_TEST_PACKS
+#endif
+
 #define ALL_TEST_PACKS                                 \
   (pack<std::int8_t, 16>),  (pack<std::int8_t, 32>),   \
   (pack<std::uint8_t, 16>), (pack<std::uint8_t, 32>),  \
@@ -40,7 +56,14 @@ void is_same_test(T, T) {}
   (pack<std::uint32_t, 4>), (pack<std::uint32_t, 8>),  \
   (pack<std::int64_t, 2>),  (pack<std::int64_t, 4>),   \
   (pack<std::uint64_t, 2>), (pack<std::uint64_t, 4>),  \
-  (pack<const int*, 2>),    (pack<const int*, 4>)
+  (pack<const int*, 2>),    (pack<const int*, 4>)      \
+  AVX512_TEST_PACKS
+
+// Tests that don't rely on integer bit patterns also run for floats.
+#define FLOATING_TEST_PACKS                   \
+  (pack<float, 4>),         (pack<float, 8>), \
+  (pack<double, 2>),        (pack<double, 4>) \
+  AVX512_FLOATING_TEST_PACKS
 // clang-format on
 
 TEST_CASE("simd.pack.types.register_t", "[simd]") {
@@ -59,6 +82,23 @@ TEST_CASE("simd.pack.types.register_t", "[simd]") {
 
   is_same_test(mm::register_i<256>{}, register_t<pack<std::int64_t, 4>>{});
   is_same_test(mm::register_i<256>{}, register_t<pack<int*, 4>>{});
+
+  is_same_test(mm::register_ps<128>{}, register_t<pack<float, 4>>{});
+  is_same_test(mm::register_ps<256>{}, register_t<pack<float, 8>>{});
+  is_same_test(mm::register_pd<128>{}, register_t<pack<double, 2>>{});
+  is_same_test(mm::register_pd<256>{}, register_t<pack<double, 4>>{});
+
+  is_same_test(mm::register_i<512>{}, register_t<pack<std::int8_t, 64>>{});
+  is_same_test(mm::register_i<512>{}, register_t<pack<std::uint64_t, 8>>{});
+  is_same_test(mm::register_ps<512>{}, register_t<pack<float, 16>>{});
+  is_same_test(mm::register_pd<512>{}, register_t<pack<double, 8>>{});
+}
+
+TEST_CASE("simd.pack.types.top_bits", "[simd]") {
+  STATIC_REQUIRE(std::is_same_v<std::uint32_t,
+                                top_bits<pack<std::int8_t, 32>>::raw_type>);
+  STATIC_REQUIRE(std::is_same_v<std::uint64_t,
+                                top_bits<pack<std::int8_t, 64>>::raw_type>);
 }
 
 TEST_CASE("simd.pack.types.vbool_t", "[simd]") {
@@ -66,9 +106,12 @@ TEST_CASE("simd.pack.types.vbool_t", "[simd]") {
   is_same_test(pack<std::uint8_t, 16>{}, vbool_t<pack<std::uint8_t, 16>>{});
   is_same_test(pack<std::uint16_t, 16>{}, vbool_t<pack<std::uint16_t, 16>>{});
   is_same_test(pack<std::uint64_t, 4>{}, vbool_t<pack<const int*, 4>>{});
+  is_same_test(pack<std::uint32_t, 8>{}, vbool_t<pack<float, 8>>{});
+  is_same_test(pack<std::uint64_t, 2>{}, vbool_t<pack<double, 2>>{});
 }
 
-TEMPLATE_TEST_CASE("simd.pack.size/alignment", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.size/alignment", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using reg_t = register_t<pack_t>;
 
@@ -76,7 +119,8 @@ TEMPLATE_TEST_CASE("simd.pack.size/alignment", "[simd]", ALL_TEST_PACKS) {
   STATIC_REQUIRE(alignof(pack_t) == mm::alignment<reg_t>());
 }
 
-TEMPLATE_TEST_CASE("simd.pack.totally_ordered", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.totally_ordered", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -161,7 +205,8 @@ TEMPLATE_TEST_CASE("simd.pack.totally_ordered", "[simd]", ALL_TEST_PACKS) {
   }
 }
 
-TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.comparisons_pairwise", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using vbool = vbool_t<pack_t>;
 
@@ -234,6 +279,7 @@ TEMPLATE_TEST_CASE("simd.pack.top_bits", "[simd]", ALL_TEST_PACKS) {
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
   using uscalar = unsigned_equivalent<scalar>;
+  using raw_type = typename top_bits<pack_t>::raw_type;
 
   const scalar zero = (scalar)0;
   const scalar FF = (scalar)all_ones<uscalar>();
@@ -255,7 +301,7 @@ TEMPLATE_TEST_CASE("simd.pack.top_bits", "[simd]", ALL_TEST_PACKS) {
     REQUIRE(0 == run().raw);
 
     a.fill(FF);
-    REQUIRE(set_lower_n_bits(sizeof(pack_t)) == run().raw);
+    REQUIRE(set_lower_n_bits<raw_type>(sizeof(pack_t)) == run().raw);
 
     a.fill(zero);
     a[0] = FF;
@@ -343,6 +389,20 @@ TEMPLATE_TEST_CASE("simd.pack.top_bits", "[simd]", ALL_TEST_PACKS) {
     REQUIRE(all_true(run()));
   }
 
+  SECTION("count true") {
+    a.fill(zero);
+    REQUIRE(0u == count_true(run()));
+    REQUIRE(size == count_true(~run()));
+
+    for (std::uint32_t i = 0; i != size; i += 2) {
+      a[i] = FF;
+      REQUIRE(i / 2 + 1 == count_true(run()));
+    }
+
+    REQUIRE(size - (size + 1) / 2 == count_true(~run()));
+    REQUIRE(0u == count_true(run(ignore_first_n_mask<pack_t>(size))));
+  }
+
   SECTION("operators") {
     using tb = top_bits<pack_t>;
     const tb x{3}, y{5};
@@ -366,7 +426,7 @@ TEMPLATE_TEST_CASE("simd.pack.top_bits", "[simd]", ALL_TEST_PACKS) {
     }
 
     {
-      tb expected{~3u};
+      tb expected{~raw_type{3}};
 
       REQUIRE(~x == expected);
     }
@@ -528,7 +588,8 @@ TEMPLATE_TEST_CASE("simd.pack.arithmetic", "[simd]", ALL_TEST_PACKS) {
   }
 }
 
-TEMPLATE_TEST_CASE("simd.pack.set", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.set", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -596,7 +657,8 @@ TEST_CASE("simd.pack.address_manipulation", "[simd]") {
   }
 }
 
-TEMPLATE_TEST_CASE("simd.pack.blend", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.blend", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -1025,7 +1087,60 @@ TEMPLATE_TEST_CASE("simd.pack.compress_store_masked", "[simd]",
   }
 }
 
-TEMPLATE_TEST_CASE("simd.pack.swap_adjacent", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.compress_store_exact", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using vbool = vbool_t<pack_t>;
+  using scalar = scalar_t<pack_t>;
+  using bool_t = scalar_t<vbool>;
+
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> input;
+  alignas(vbool) std::array<bool_t, size> mask;
+
+  for (std::size_t i = 0; i != input.size(); ++i) {
+    input[i] = (scalar)(i + 1);
+  }
+
+  // Output is exactly the size of the result, so asan would catch
+  // any access after.
+  auto run = [&] {
+    const vbool loaded_mask = load<vbool>(mask.data());
+    const auto mmask =
+        get_top_bits(greater_pairwise(loaded_mask, set_zero<vbool>()));
+
+    std::vector<scalar> expected;
+    for (std::size_t i = 0; i != size; ++i) {
+      if (mask[i]) expected.push_back(input[i]);
+    }
+
+    std::vector<scalar> actual(expected.size());
+    const pack_t loaded_input = load<pack_t>(input.data());
+    auto* res = compress_store_exact(actual.data(), loaded_input, mmask);
+
+    REQUIRE(res == actual.data() + actual.size());
+    REQUIRE(expected == actual);
+  };
+
+  mask.fill(0);
+  run();
+
+  for (std::size_t i = 0; i != size; ++i) {
+    mask.fill(0);
+    mask[i] = 1;
+    run();
+
+    std::fill(mask.begin(), mask.begin() + i, 1);
+    run();
+  }
+
+  mask.fill(1);
+  run();
+}
+
+TEMPLATE_TEST_CASE("simd.pack.swap_adjacent", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -1079,7 +1194,139 @@ TEMPLATE_TEST_CASE("simd.pack.swap_adjacent", "[simd]", ALL_TEST_PACKS) {
   }
 }
 
-TEMPLATE_TEST_CASE("simd.pack.reduce", "[simd]", ALL_TEST_PACKS) {
+#ifdef __AVX512BW__
+#define BYTE_SET_TEST_PACKS \
+  (pack<std::uint8_t, 16>), (pack<std::uint8_t, 32>), (pack<std::uint8_t, 64>)
+#else
+#define BYTE_SET_TEST_PACKS (pack<std::uint8_t, 16>), (pack<std::uint8_t, 32>)
+#endif
+
+TEMPLATE_TEST_CASE("simd.pack.byte_set", "[simd]", BYTE_SET_TEST_PACKS) {
+  using pack_t = TestType;
+  constexpr std::size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<std::uint8_t, 256> all_bytes;
+  std::iota(all_bytes.begin(), all_bytes.end(), 0);
+
+  auto run = [&](const std::vector<std::uint8_t>& elements) {
+    const byte_set<size> set(elements.begin(), elements.end());
+
+    for (std::size_t i = 0; i != all_bytes.size(); i += size) {
+      const auto actual = to_array(set.contains(load<pack_t>(&all_bytes[i])));
+      for (std::size_t j = 0; j != size; ++j) {
+        const bool expected =
+            std::find(elements.begin(), elements.end(), all_bytes[i + j]) !=
+            elements.end();
+        REQUIRE(expected == static_cast<bool>(actual[j]));
+      }
+    }
+  };
+
+  run({});
+  run({0});
+  run({',', '\n', '"', '\\'});
+  run({0x80, 0xff, 0x7f, 0x08, 0x88});
+  run({all_bytes.begin(), all_bytes.end()});
+
+  std::vector<std::uint8_t> every_third;
+  for (std::size_t i = 0; i < 256; i += 3) {
+    every_third.push_back(static_cast<std::uint8_t>(i));
+  }
+  run(every_third);
+}
+
+template <typename Op, std::size_t... idx>
+void for_each_shift(Op op, std::index_sequence<idx...>) {
+  (op(std::integral_constant<std::size_t, idx + 1>{}), ...);
+}
+
+TEMPLATE_TEST_CASE("simd.pack.shift_elements_right", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> input;
+  std::iota(input.begin(), input.end(), (scalar)1);
+
+  auto run = [&](auto constant) {
+    constexpr std::size_t n = decltype(constant){}();
+    alignas(pack_t) std::array<scalar, size> expected{};
+    std::copy(input.begin(), input.end() - n, expected.begin() + n);
+
+    const pack_t actual = shift_elements_right<n>(load<pack_t>(input.data()));
+    REQUIRE(load<pack_t>(expected.data()) == actual);
+  };
+
+  for_each_shift(run, std::make_index_sequence<size - 1>{});
+}
+
+TEMPLATE_TEST_CASE("simd.pack.rotate_elements_right", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> input;
+  std::iota(input.begin(), input.end(), (scalar)1);
+
+  auto run = [&](auto constant) {
+    constexpr std::size_t n = decltype(constant){}();
+    alignas(pack_t) std::array<scalar, size> expected;
+    std::rotate_copy(input.begin(), input.end() - n, input.end(),
+                     expected.begin());
+
+    const pack_t actual = rotate_elements_right<n>(load<pack_t>(input.data()));
+    REQUIRE(load<pack_t>(expected.data()) == actual);
+  };
+
+  for_each_shift(run, std::make_index_sequence<size - 1>{});
+}
+
+TEMPLATE_TEST_CASE("simd.pack.broadcast_last", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> input;
+  std::iota(input.begin(), input.end(), (scalar)1);
+
+  const pack_t actual = broadcast_last(load<pack_t>(input.data()));
+  REQUIRE(set_all<pack_t>(input.back()) == actual);
+}
+
+TEMPLATE_TEST_CASE("simd.pack.inclusive_scan", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> input, expected;
+  std::iota(input.begin(), input.end(), (scalar)1);
+
+  SECTION("add") {
+    if constexpr (!std::is_pointer_v<scalar>) {
+      std::partial_sum(input.begin(), input.end(), expected.begin());
+      const pack_t actual =
+          inclusive_scan(load<pack_t>(input.data()),
+                         [](auto x, auto y) { return add_pairwise(x, y); });
+      REQUIRE(load<pack_t>(expected.data()) == actual);
+    }
+  }
+
+  SECTION("max") {
+    std::reverse(input.begin(), input.end());
+    std::fill(expected.begin(), expected.end(), input[0]);
+    const pack_t actual =
+        inclusive_scan(load<pack_t>(input.data()),
+                       [](auto x, auto y) { return max_pairwise(x, y); });
+    REQUIRE(load<pack_t>(expected.data()) == actual);
+  }
+}
+
+TEMPLATE_TEST_CASE("simd.pack.reduce", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -1115,7 +1362,8 @@ TEMPLATE_TEST_CASE("simd.pack.reduce", "[simd]", ALL_TEST_PACKS) {
   run();
 }
 
-TEMPLATE_TEST_CASE("simd.pack.replace_ignored", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.replace_ignored", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   using vbool = vbool_t<pack_t>;
@@ -1153,7 +1401,8 @@ TEMPLATE_TEST_CASE("simd.pack.replace_ignored", "[simd]", ALL_TEST_PACKS) {
   run();
 }
 
-TEMPLATE_TEST_CASE("simd.pack.to_array", "[simd]", ALL_TEST_PACKS) {
+TEMPLATE_TEST_CASE("simd.pack.to_array", "[simd]", ALL_TEST_PACKS,
+                   FLOATING_TEST_PACKS) {
   using pack_t = TestType;
   using scalar = scalar_t<pack_t>;
   constexpr size_t size = size_v<pack_t>;
@@ -1165,5 +1414,88 @@ TEMPLATE_TEST_CASE("simd.pack.to_array", "[simd]", ALL_TEST_PACKS) {
   REQUIRE(input == to_array(loaded));
 }
 
+TEMPLATE_TEST_CASE("simd.pack.floating", "[simd]", FLOATING_TEST_PACKS) {
+  using pack_t = TestType;
+  using scalar = scalar_t<pack_t>;
+  using vbool = vbool_t<pack_t>;
+  constexpr size_t size = size_v<pack_t>;
+
+  alignas(pack_t) std::array<scalar, size> a, b, expected;
+
+  std::iota(a.begin(), a.end(), (scalar)0.5);
+  b.fill((scalar)-0.25);
+
+  const pack_t x = load<pack_t>(a.data());
+  const pack_t y = load<pack_t>(b.data());
+
+  SECTION("arithmetic") {
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(),
+                   std::plus<>{});
+    REQUIRE(to_array(x + y) == expected);
+
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(),
+                   std::minus<>{});
+    REQUIRE(to_array(x - y) == expected);
+  }
+
+  SECTION("min/max") {
+    a[1] = (scalar)-1.5;
+    const pack_t x = load<pack_t>(a.data());
+
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(),
+                   [](scalar x, scalar y) { return std::min(x, y); });
+    REQUIRE(to_array(min_pairwise(x, y)) == expected);
+
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(),
+                   [](scalar x, scalar y) { return std::max(x, y); });
+    REQUIRE(to_array(max_pairwise(x, y)) == expected);
+  }
+
+  SECTION("comparisons are float comparisons") {
+    const pack_t zero = set_zero<pack_t>();
+    const pack_t minus_zero = set_all<pack_t>((scalar)-0.0);
+
+    REQUIRE(all_true(get_top_bits(equal_pairwise(zero, minus_zero))));
+    REQUIRE_FALSE(get_top_bits(greater_pairwise(zero, minus_zero)));
+    REQUIRE(all_true(get_top_bits(greater_pairwise(x, y))));
+  }
+
+  SECTION("masks") {
+    a[0] = (scalar)-3;
+    const pack_t x = load<pack_t>(a.data());
+    const pack_t zero = set_zero<pack_t>();
+
+    const top_bits<vbool> mmask = get_top_bits(greater_pairwise(zero, x));
+    REQUIRE(mmask.raw == set_lower_n_bits(sizeof(scalar)));
+    REQUIRE(first_true(mmask) == 0u);
+    REQUIRE(all_true(get_top_bits(greater_pairwise(zero, y))));
+  }
+
+  SECTION("bits") {
+    const pack_t minus_x = xor_(x, set_all<pack_t>((scalar)-0.0));
+    std::transform(a.begin(), a.end(), expected.begin(), std::negate<>{});
+    REQUIRE(to_array(minus_x) == expected);
+
+    REQUIRE(~~x == x);
+    REQUIRE(not_x_and_y(x, x) == set_zero<pack_t>());
+  }
+
+  SECTION("compress") {
+    alignas(pack_t) std::array<scalar, size * 2> out;
+    out.fill((scalar)0);
+
+    // Keep all but the first.
+    auto mmask = ignore_first_n(get_top_bits(greater_pairwise(x, y)), 1);
+
+    scalar* o = compress_store_unsafe(out.data(), x, mmask);
+    REQUIRE(o == out.data() + size - 1);
+    REQUIRE(std::equal(a.begin() + 1, a.end(), out.begin()));
+
+    o = compress_store_masked(o, x, ignore_last_n(mmask, size - 2));
+    REQUIRE(o == out.data() + size);
+    REQUIRE(out[size - 1] == a[1]);
+  }
+}
+
 }  // namespace
 }  // namespace simd
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unsq/count.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_count_test(I f, I l) {
+  using T = ValueType<I>;
+
+  for (I cur = f; cur != l; ++cur) *cur = static_cast<T>((cur - f) % 3);
+
+  for (T x : {T(0), T(1), T(2), T(3)}) {
+    REQUIRE(unsq::count<width>(f, l, x) == std::count(f, l, x));
+  }
+
+  if (l - f < 36) return;
+  l = f + 35;
+
+  std::fill(f, l, T(1));
+
+  // masks are working
+  for (I cur = f; cur != l; ++cur) {
+    REQUIRE(unsq::count<width>(cur, l, T(1)) == l - cur);
+    REQUIRE(unsq::count<width>(f, cur, T(1)) == cur - f);
+  }
+}
+
+TEMPLATE_TEST_CASE("unsq.count", "[unsq][simd][count]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_count_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_count_test<width>(f, l);
+  });
+
+  // Counters for chars overflow after 255 loads.
+  {
+    std::vector<char> v(byte_width * 1000 + 17, 'a');
+    v[5] = 'b';
+    const auto expected = static_cast<std::ptrdiff_t>(v.size()) - 1;
+    REQUIRE(unsq::count<byte_width>(v.begin(), v.end(), 'a') == expected);
+  }
+  {
+    std::vector<std::int16_t> v(70'000 * byte_width / 2, 1);
+    const auto expected = static_cast<std::ptrdiff_t>(v.size());
+    REQUIRE(unsq::count<byte_width / 2>(v.begin(), v.end(), 1) == expected);
+  }
+  {
+    const int x = 0;
+    const std::vector<const int*> v = {nullptr, &x, nullptr};
+    REQUIRE(unsq::count<byte_width / 8>(v.begin(), v.end(), nullptr) == 2);
+  }
+}
+
+}  // namespace
+}  // namespace unsq
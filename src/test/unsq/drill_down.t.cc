@@ -35,6 +35,8 @@ TEST_CASE("unsq drill down, equivalent", "[simd]") {
   STATIC_REQUIRE(std::is_same_v<char, equivalent<char>>);
   STATIC_REQUIRE(std::is_same_v<int, equivalent<int>>);
   STATIC_REQUIRE(std::is_same_v<unsigned, equivalent<unsigned>>);
+  STATIC_REQUIRE(std::is_same_v<float, equivalent<float>>);
+  STATIC_REQUIRE(std::is_same_v<double, equivalent<double>>);
 
   struct S {
     std::int16_t _;
@@ -66,8 +66,7 @@ void one_range_find_test(I f, I l) {
 }
 
 TEMPLATE_TEST_CASE("unsq.find/unsq.find_unguarded", "[simd]",
-                   (std::integral_constant<std::size_t, 16>),
-                   (std::integral_constant<std::size_t, 32>)) {
+                   UNSQ_TEST_BYTE_WIDTHS) {
   constexpr std::size_t byte_width = TestType{};
 
   one_range_test([](auto f, auto l) {
@@ -76,6 +75,12 @@ TEMPLATE_TEST_CASE("unsq.find/unsq.find_unguarded", "[simd]",
     one_range_find_test<width>(f, l);
   });
 
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_find_test<width>(f, l);
+  });
+
   {
     const char* some_str = "abc";
     auto* end =
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unsq/find_first_of.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_find_first_of_test(I f, I l) {
+  using T = ValueType<I>;
+
+  if (sizeof(T) == 1) {
+    l = std::min(l, f + 128);
+  }
+
+  // Set values are below 10.
+  std::iota(f, l, T(10));
+
+  // All set sizes: no matches, matches in every position.
+  for (std::size_t n = 0; n != 10; ++n) {
+    std::vector<T> set(n);
+    std::iota(set.begin(), set.end(), T(0));
+    REQUIRE(unsq::find_first_of<width>(f, l, set.begin(), set.end()) ==
+            std::find_first_of(f, l, set.begin(), set.end()));
+
+    for (I cur = f; cur != l; ++cur) {
+      std::vector<T> with_cur = set;
+      with_cur.insert(with_cur.begin() + n / 2, *cur);
+      REQUIRE(unsq::find_first_of<width>(f, l, with_cur.begin(),
+                                         with_cur.end()) == cur);
+    }
+  }
+
+  if (l - f < 36) return;
+  l = f + 35;
+
+  // masks are working
+  const std::vector<T> set{T(11), T(12), T(13), T(14), T(15), T(16)};
+  for (std::size_t n : {1, 3, 6}) {
+    for (I cur = f; cur != l; ++cur) {
+      REQUIRE(unsq::find_first_of<width>(cur, l, set.begin(),
+                                         set.begin() + n) ==
+              std::find_first_of(cur, l, set.begin(), set.begin() + n));
+      REQUIRE(unsq::find_first_of<width>(f, cur, set.begin(),
+                                         set.begin() + n) ==
+              std::find_first_of(f, cur, set.begin(), set.begin() + n));
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("unsq.find_first_of", "[unsq][simd][find_first_of]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_find_first_of_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_find_first_of_test<width>(f, l);
+  });
+
+  {
+    const std::string csv = "abc def ghi\\\"jkl,mno\n";
+    const char* delimiters = ",\n\"\\";
+    auto found = unsq::find_first_of<byte_width>(
+        csv.begin(), csv.end(), delimiters, delimiters + 4);
+    REQUIRE(found - csv.begin() == 11);
+  }
+}
+
+}  // namespace
+}  // namespace unsq
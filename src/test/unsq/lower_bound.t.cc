@@ -0,0 +1,98 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unsq/lower_bound.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_lower_bound_test(I f, I l) {
+  using T = ValueType<I>;
+
+  auto run = [&] {
+    for (T v = 0; v != 101; ++v) {
+      REQUIRE(std::lower_bound(f, l, v) == unsq::lower_bound<width>(f, l, v));
+    }
+  };
+
+  // Unique values
+  for (I it = f; it != l; ++it) *it = static_cast<T>(1 + (it - f) % 100);
+  std::sort(f, l);
+  run();
+
+  // Duplicates
+  for (I it = f; it != l; ++it) *it = static_cast<T>(1 + (it - f) / 3 % 100);
+  std::sort(f, l);
+  run();
+
+  // All the same
+  std::fill(f, l, T(50));
+  run();
+}
+
+TEMPLATE_TEST_CASE("unsq.lower_bound", "[unsq][simd][lower_bound]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_lower_bound_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_lower_bound_test<width>(f, l);
+  });
+}
+
+TEMPLATE_TEST_CASE("unsq.lower_bound.big", "[unsq][simd][lower_bound]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  auto run = [](auto type) {
+    using T = decltype(type);
+    constexpr std::size_t width = byte_width / sizeof(T);
+
+    for (std::size_t size : {1000u, 4097u, 100'000u}) {
+      std::vector<T> data(size);
+      for (std::size_t i = 0; i != size; ++i) data[i] = static_cast<T>(i * 2);
+      const std::vector<T>& input = data;
+
+      for (std::size_t v = 0; v <= 2 * size + 1; v += 1 + v % 7) {
+        const T x = static_cast<T>(v);
+        REQUIRE(std::lower_bound(input.begin(), input.end(), x) ==
+                unsq::lower_bound<width>(input.begin(), input.end(), x));
+      }
+    }
+  };
+
+  run(int{});
+  run(std::int64_t{});
+  run(float{});
+}
+
+}  // namespace
+}  // namespace unsq
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unsq/minmax_element.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void compare_with_std(I f, I l) {
+  REQUIRE(unsq::min_element<width>(f, l) == std::min_element(f, l));
+  REQUIRE(unsq::max_element<width>(f, l) == std::max_element(f, l));
+  REQUIRE(unsq::minmax_element<width>(f, l) == std::minmax_element(f, l));
+}
+
+template <std::size_t width, typename I>
+void one_range_minmax_element_test(I f, I l) {
+  using T = ValueType<I>;
+
+  // A lot of equal elements, ties have to be resolved as in std.
+  for (I cur = f; cur != l; ++cur) *cur = static_cast<T>((cur - f) % 5);
+  compare_with_std<width>(f, l);
+
+  std::fill(f, l, T(1));
+  compare_with_std<width>(f, l);
+
+  if (f == l) return;
+
+  auto mid = f + ((l - f) >> 1);
+  *mid = T(0);
+  compare_with_std<width>(f, l);
+  *mid = T(2);
+  compare_with_std<width>(f, l);
+  *mid = T(1);
+
+  if (l - f < 36) return;
+  l = f + 35;  // l is writable
+
+  std::iota(f, l, T{});
+
+  // masks are working
+  for (I cur = f; cur != l; ++cur) {
+    compare_with_std<width>(cur, l);
+    compare_with_std<width>(f, cur);
+  }
+
+  std::reverse(f, l);
+  for (I cur = f; cur != l; ++cur) {
+    compare_with_std<width>(cur, l);
+    compare_with_std<width>(f, cur);
+  }
+}
+
+TEMPLATE_TEST_CASE("unsq.minmax_element", "[unsq][simd][minmax_element]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_minmax_element_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_minmax_element_test<width>(f, l);
+  });
+
+  // Block numbers for chars overflow after 255 blocks.
+  {
+    std::vector<std::int8_t> v(byte_width * 3000 + 17);
+    for (std::size_t i = 0; i != v.size(); ++i) {
+      v[i] = static_cast<std::int8_t>(i % 100);
+    }
+    compare_with_std<byte_width>(v.begin(), v.end());
+
+    v[byte_width * 2100 + 3] = -5;
+    v[byte_width * 2700 + 1] = -5;
+    v[byte_width * 900 + 2] = 127;
+    v[byte_width * 2400] = 127;
+    compare_with_std<byte_width>(v.begin(), v.end());
+    compare_with_std<byte_width>(v.begin() + 1, v.end() - 1);
+  }
+  // And for shorts after 65535 blocks.
+  {
+    std::vector<std::uint16_t> v(530'000 * byte_width / 2, 3);
+    v[v.size() - 10] = 0;
+    v[v.size() / 2] = 0;
+    v[100] = 4;
+    v[v.size() - 100] = 4;
+    compare_with_std<byte_width / 2>(v.begin(), v.end());
+  }
+}
+
+}  // namespace
+}  // namespace unsq
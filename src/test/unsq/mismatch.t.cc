@@ -0,0 +1,138 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unsq/mismatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_mismatch_test(I f, I l) {
+  using T = ValueType<I>;
+
+  if (sizeof(T) == 1) {
+    l = std::min(l, f + 128);
+  }
+
+  std::iota(f, l, T(0));
+  std::vector<T> copy(f, l);
+
+  REQUIRE(unsq::equal<width>(f, l, copy.begin()));
+  REQUIRE(unsq::equal<width>(f, l, copy.begin(), copy.end()));
+  REQUIRE(unsq::mismatch<width>(f, l, copy.begin()).first == l);
+
+  for (auto it = copy.begin(); it != copy.end(); ++it) {
+    const std::ptrdiff_t i = it - copy.begin();
+    *it = static_cast<T>(*it + 1);
+
+    auto [x, y] = unsq::mismatch<width>(f, l, copy.begin());
+    REQUIRE(x - f == i);
+    REQUIRE(y == it);
+    REQUIRE(!unsq::equal<width>(f, l, copy.begin()));
+
+    // Mismatch is outside of the range.
+    REQUIRE(unsq::equal<width>(f, f + i, copy.begin()));
+    REQUIRE(unsq::equal<width>(f + i + 1, l, it + 1));
+
+    *it = static_cast<T>(*it - 1);
+  }
+
+  if (f == l) return;
+  REQUIRE(!unsq::equal<width>(f, l, copy.begin(), copy.end() - 1));
+}
+
+TEMPLATE_TEST_CASE("unsq.mismatch/equal", "[unsq][simd][mismatch]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_mismatch_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_mismatch_test<width>(f, l);
+  });
+
+  // Same as operator== for floating point.
+  {
+    constexpr std::size_t width = byte_width / sizeof(double);
+    std::vector<double> x(50, 1.0);
+    std::vector<double> y = x;
+    x[40] = 0.0;
+    y[40] = -0.0;
+    REQUIRE(unsq::equal<width>(x.begin(), x.end(), y.begin()));
+
+    x[45] = y[45] = std::nan("");
+    REQUIRE(unsq::mismatch<width>(x.begin(), x.end(), y.begin()).first ==
+            x.begin() + 45);
+  }
+  {
+    int a = 0;
+    int b = 0;
+    const std::vector<const int*> x = {nullptr, &a, &b};
+    const std::vector<const int*> y = {nullptr, &a, &a};
+    auto [mx, my] = unsq::mismatch<byte_width / 8>(x.begin(), x.end(), y.data());
+    REQUIRE(mx == x.begin() + 2);
+    REQUIRE(my == y.data() + 2);
+  }
+}
+
+struct record {
+  std::uint64_t fields[8];
+};
+
+static_assert(sizeof(record) == 64);
+
+TEMPLATE_TEST_CASE("unsq.mismatch/equal.bytes", "[unsq][simd][mismatch]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  for (std::size_t size : {0, 1, 2, 3, 10}) {
+    std::vector<record> x(size);
+    for (std::size_t i = 0; i != size; ++i) {
+      for (std::size_t j = 0; j != 8; ++j) x[i].fields[j] = i * 8 + j;
+    }
+
+    std::vector<record> y = x;
+    REQUIRE(unsq::equal<byte_width>(x.begin(), x.end(), y.begin(), y.end()));
+
+    for (std::size_t i = 0; i != size; ++i) {
+      for (std::size_t j = 0; j != 8; ++j) {
+        ++y[i].fields[j];
+        auto [mx, my] = unsq::mismatch<byte_width>(x.begin(), x.end(), y.data());
+        REQUIRE(mx == x.begin() + static_cast<std::ptrdiff_t>(i));
+        REQUIRE(my == y.data() + i);
+        REQUIRE(!unsq::equal<byte_width>(x.begin(), x.end(), y.begin()));
+        --y[i].fields[j];
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace unsq
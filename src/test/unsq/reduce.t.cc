@@ -16,6 +16,9 @@
 
 #include "unsq/reduce.h"
 
+#include <numeric>
+#include <vector>
+
 #include "test/catch.h"
 #include "test/unsq/test_input.h"
 
@@ -70,8 +73,7 @@ void one_range_min_max_value_test(I f, I l) {
 }
 
 TEMPLATE_TEST_CASE("unsq.reduce", "[unsq][simd][reduce]",
-                   (std::integral_constant<std::size_t, 16>),
-                   (std::integral_constant<std::size_t, 32>)) {
+                   UNSQ_TEST_BYTE_WIDTHS) {
   constexpr std::size_t byte_width = TestType{};
 
   one_range_test([](auto f, auto l) {
@@ -80,6 +82,80 @@ TEMPLATE_TEST_CASE("unsq.reduce", "[unsq][simd][reduce]",
     one_range_reduce_sum_test<width>(f, l);
     one_range_min_max_value_test<width>(f, l);
   });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_reduce_sum_test<width>(f, l);
+    one_range_min_max_value_test<width>(f, l);
+  });
+}
+
+template <typename T>
+void parallel_reduce_test(algo::thread_pool& pool) {
+  constexpr std::size_t width = 32 / sizeof(T);
+  constexpr std::size_t n_in_page = simd::page_size() / sizeof(T);
+
+  std::vector<T> v(70 * n_in_page + 13);
+  std::iota(v.begin(), v.end(), T{0});
+  for (auto& x : v) x = static_cast<T>(static_cast<int>(x) % 100);
+
+  const std::vector<std::size_t> sizes{0, 1, 100, 16 * n_in_page,
+                                       33 * n_in_page + 5, v.size()};
+  for (std::size_t size : sizes) {
+    for (std::size_t offset : {0, 3}) {
+      if (offset > size) continue;
+      auto f = v.begin() + static_cast<std::ptrdiff_t>(offset);
+      auto l = v.begin() + static_cast<std::ptrdiff_t>(size);
+
+      const T expected = std::accumulate(f, l, T{0});
+      REQUIRE(unsq::reduce<width>(pool, f, l) == expected);
+      REQUIRE(unsq::min_value<width>(pool, f, l) == unsq::min_value<width>(f, l));
+      REQUIRE(unsq::max_value<width>(pool, f, l) == unsq::max_value<width>(f, l));
+    }
+  }
+
+  // Min and max in different chunks.
+  v[5] = T{-1};
+  v[v.size() - 5] = T{101};
+  REQUIRE(unsq::min_value<width>(pool, v.begin(), v.end()) == T{-1});
+  REQUIRE(unsq::max_value<width>(pool, v.begin(), v.end()) == T{101});
+}
+
+TEST_CASE("unsq.reduce.page_aligned_chunks", "[unsq][reduce]") {
+  constexpr std::ptrdiff_t n_in_page = simd::page_size() / sizeof(int);
+  std::vector<int> v(100 * n_in_page);
+
+  for (std::ptrdiff_t offset : {0, 1, 100}) {
+    for (std::size_t max_chunks : {1, 2, 3, 8, 100}) {
+      const auto f = v.data() + offset;
+      const auto l = v.data() + v.size();
+      const std::vector<int*> chunks = page_aligned_chunks(f, l, max_chunks);
+
+      REQUIRE(chunks.size() >= 2);
+      REQUIRE(chunks.size() - 1 <= max_chunks);
+      REQUIRE(chunks.front() == f);
+      REQUIRE(chunks.back() == l);
+
+      for (std::size_t i = 1; i + 1 < chunks.size(); ++i) {
+        REQUIRE(chunks[i - 1] < chunks[i]);
+        REQUIRE(simd::end_of_page(chunks[i] - 1) == chunks[i]);
+        REQUIRE(chunks[i + 1] - chunks[i] >= kMinPagesInChunk * n_in_page);
+      }
+    }
+  }
+
+  const std::vector<int*> empty = page_aligned_chunks(v.data(), v.data(), 4);
+  REQUIRE(empty == std::vector<int*>{v.data(), v.data()});
+}
+
+TEST_CASE("unsq.reduce.parallel", "[unsq][simd][reduce]") {
+  for (std::size_t n_threads : {1, 2, 4}) {
+    algo::thread_pool pool(n_threads);
+    parallel_reduce_test<int>(pool);
+    parallel_reduce_test<double>(pool);
+    parallel_reduce_test<std::int64_t>(pool);
+  }
 }
 
 }  // namespace
@@ -17,7 +17,11 @@
 #include "unsq/remove.h"
 
 #include <algorithm>
+#include <iterator>
+#include <memory>
 #include <numeric>
+#include <random>
+#include <vector>
 
 #include "test/catch.h"
 #include "test/unsq/test_input.h"
@@ -84,8 +88,130 @@ TEST_CASE("unsq.remove very basic", "[unsq][simd]") {
 
     one_range_remove_zero_test<small_pack_size>(f, l);
     one_range_remove_zero_test<big_pack_size>(f, l);
+
+#ifdef __AVX512BW__
+    one_range_remove_zero_test<big_pack_size * 2>(f, l);
+#endif
   });
 }
 
+template <std::size_t width, typename I>
+void one_range_copy_if_test(I f, I l) {
+  using T = ValueType<I>;
+
+  auto run = [&] {
+    const std::vector<T> input(f, l);
+
+    std::vector<T> expected;
+    std::copy_if(f, l, std::back_inserter(expected),
+                 [](const T& x) { return x != 0; });
+
+    // Exactly the size of the result, writing past the end is an error.
+    std::vector<T> actual(expected.size());
+    T* actual_end = unsq::remove_copy<width>(f, l, actual.data(), 0);
+    REQUIRE(actual_end == actual.data() + actual.size());
+    REQUIRE(expected == actual);
+
+    std::fill(actual.begin(), actual.end(), T{0});
+    using pack = simd::pack<equivalent<T>, width>;
+    actual_end =
+        unsq::copy_if<width>(f, l, actual.data(), [](const pack& xs) {
+          return ~simd::equal_pairwise(xs, simd::set_zero<pack>());
+        });
+    REQUIRE(actual_end == actual.data() + actual.size());
+    REQUIRE(expected == actual);
+
+    REQUIRE(input == std::vector<T>(f, l));
+  };
+
+  // No zeroes
+  std::iota(f, l, 1);
+  run();
+
+  // Only zeroes
+  std::fill(f, l, 0);
+  run();
+
+  // Every third is not zero
+  for (I it = f; it != l; ++it) {
+    *it = (it - f) % 3 ? 0 : static_cast<T>(it - f + 1);
+  }
+  run();
+
+  // Random
+  std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, 3);
+  for (I it = f; it != l; ++it) *it = static_cast<T>(dis(g));
+  run();
+}
+
+TEST_CASE("unsq.remove_copy/copy_if", "[unsq][simd]") {
+  one_range_test([](auto f, auto l) {
+    constexpr std::size_t small_pack_size = 16 / sizeof(ValueType<decltype(f)>);
+    constexpr std::size_t big_pack_size = small_pack_size * 2;
+
+    one_range_copy_if_test<small_pack_size>(f, l);
+    one_range_copy_if_test<big_pack_size>(f, l);
+
+#ifdef __AVX512BW__
+    one_range_copy_if_test<big_pack_size * 2>(f, l);
+#endif
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    constexpr std::size_t width = 32 / sizeof(ValueType<decltype(f)>);
+    one_range_copy_if_test<width>(f, l);
+  });
+}
+
+template <typename T>
+void parallel_remove_test(algo::thread_pool& pool) {
+  constexpr std::size_t width = 32 / sizeof(T);
+  constexpr std::size_t n_in_page = simd::page_size() / sizeof(T);
+  constexpr std::size_t max_size = 70 * n_in_page + 13;
+
+  // Allocating pages - remove is allowed to read outside of the range.
+  std::unique_ptr<T, page_deallocator> buffer(
+      new (page_alignment) T[71 * n_in_page]);
+  T* f = buffer.get();
+
+  std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, 99);
+
+  const std::vector<std::size_t> sizes{0, 1, 100, 16 * n_in_page + 3,
+                                       max_size};
+
+  for (std::size_t size : sizes) {
+    for (int percentage : {0, 5, 50, 95, 100}) {
+      std::vector<T> input(size);
+      for (auto& x : input) {
+        x = dis(g) < percentage ? T{0} : static_cast<T>(dis(g) + 1);
+      }
+
+      for (std::size_t offset : {0, 3}) {
+        if (offset > size) continue;
+        std::vector<T> expected(input.begin() + offset, input.end());
+        expected.erase(std::remove(expected.begin(), expected.end(), T{0}),
+                       expected.end());
+
+        std::copy(input.begin(), input.end(), f);
+        T* actual_end = unsq::remove<width>(pool, f + offset, f + size, 0);
+        REQUIRE(expected == std::vector<T>(f + offset, actual_end));
+        // Nothing before f is touched.
+        REQUIRE(std::equal(f, f + offset, input.begin()));
+      }
+    }
+  }
+}
+
+TEST_CASE("unsq.remove.parallel", "[unsq][simd]") {
+  for (std::size_t n_threads : {1, 2, 3, 8}) {
+    algo::thread_pool pool(n_threads);
+    parallel_remove_test<char>(pool);
+    parallel_remove_test<int>(pool);
+    parallel_remove_test<double>(pool);
+  }
+}
+
 }  // namespace
 }  // namespace unsq
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unsq/scan.h"
+
+#include <numeric>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_scan_test(I f, I l) {
+  using T = ValueType<I>;
+
+  for (I cur = f; cur != l; ++cur) *cur = static_cast<T>((cur - f) % 5 + 1);
+
+  const std::vector<T> input(f, l);
+  std::vector<T> expected(input.size());
+  std::vector<T> actual(input.size());
+
+  std::inclusive_scan(input.begin(), input.end(), expected.begin());
+  auto o = unsq::inclusive_scan<width>(input.begin(), input.end(),
+                                       actual.begin());
+  REQUIRE(o == actual.end());
+  REQUIRE(expected == actual);
+
+  std::exclusive_scan(input.begin(), input.end(), expected.begin(), T(3));
+  o = unsq::exclusive_scan<width>(input.begin(), input.end(), actual.begin(),
+                                  T(3));
+  REQUIRE(o == actual.end());
+  REQUIRE(expected == actual);
+
+  std::inclusive_scan(input.begin(), input.end(), expected.begin(),
+                      std::plus<>{}, T(3));
+  unsq::inclusive_scan<width>(input.begin(), input.end(), actual.begin(),
+                              T(3));
+  REQUIRE(expected == actual);
+
+  // In place, the range is at the page boundary.
+  std::inclusive_scan(f, l, expected.begin());
+  REQUIRE(unsq::inclusive_scan<width>(f, l, f) == l);
+  REQUIRE(std::equal(f, l, expected.begin()));
+}
+
+TEMPLATE_TEST_CASE("unsq.scan", "[unsq][simd][scan]", UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_scan_test<width>(f, l);
+  });
+
+  // Overflow wraps the same way.
+  {
+    std::vector<std::uint8_t> v(1000, 200);
+    std::vector<std::uint8_t> expected(v.size());
+    std::exclusive_scan(v.begin(), v.end(), expected.begin(), std::uint8_t{7});
+    unsq::exclusive_scan<byte_width>(v.begin(), v.end(), v.begin(),
+                                     std::uint8_t{7});
+    REQUIRE(expected == v);
+  }
+}
+
+}  // namespace
+}  // namespace unsq
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unsq/search.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_search_test(I f, I l) {
+  using T = ValueType<I>;
+
+  // Small alphabet, so there are a lot of candidates.
+  for (I cur = f; cur != l; ++cur) {
+    *cur = static_cast<T>((cur - f) % 7 % 3);
+  }
+
+  if (sizeof(T) == 1) {
+    l = std::min(l, f + 300);
+  }
+
+  // Needles from the end test the last loads.
+  for (std::ptrdiff_t m = 0; m <= std::min<std::ptrdiff_t>(l - f, 40); ++m) {
+    REQUIRE(unsq::search<width>(f, l, l - m, l) == std::search(f, l, l - m, l));
+    REQUIRE(unsq::search<width>(f, l - 1, l - m, l) ==
+            std::search(f, l - 1, l - m, l));
+  }
+}
+
+template <typename T>
+void random_search_test() {
+  constexpr std::size_t width = 32 / sizeof(T);
+
+  std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, 2);
+
+  auto make_vector = [&](std::size_t size) {
+    std::vector<T> res(size);
+    std::generate(res.begin(), res.end(), [&] { return static_cast<T>(dis(g)); });
+    return res;
+  };
+
+  for (std::size_t size = 0; size < 200; size += 7) {
+    const std::vector<T> haystack = make_vector(size);
+    for (std::size_t m = 0; m < 12; ++m) {
+      const std::vector<T> needle = make_vector(m);
+      auto expected = std::search(haystack.begin(), haystack.end(),
+                                  needle.begin(), needle.end());
+      auto actual = unsq::search<width>(haystack.begin(), haystack.end(),
+                                        needle.begin(), needle.end());
+      REQUIRE(expected == actual);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("unsq.search", "[unsq][simd][search]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_search_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_search_test<width>(f, l);
+  });
+}
+
+TEST_CASE("unsq.search.random", "[unsq][simd][search]") {
+  random_search_test<char>();
+  random_search_test<short>();
+  random_search_test<int>();
+  random_search_test<double>();
+
+  {
+    const std::vector<char> haystack{'a', 'b', 'c'};
+    const char* needle = "bc";
+    auto found = unsq::search<16>(haystack.begin(), haystack.end(), needle,
+                                  needle + 2);
+    REQUIRE(found == haystack.begin() + 1);
+  }
+}
+
+}  // namespace
+}  // namespace unsq
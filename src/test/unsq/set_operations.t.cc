@@ -0,0 +1,113 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unsq/set_operations.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <typename T>
+std::vector<T> random_set(std::mt19937& g, std::size_t size, int percentage) {
+  std::uniform_int_distribution<int> dis(0, 99);
+  std::vector<T> res;
+  for (T x = 0; res.size() != size; ++x) {
+    if (dis(g) < percentage) res.push_back(x);
+  }
+  return res;
+}
+
+template <std::size_t width, typename T>
+void set_operations_test(const std::vector<T>& xs, const std::vector<T>& ys) {
+  auto run = [&](auto std_op, auto unsq_op) {
+    std::vector<T> expected;
+    std_op(xs.begin(), xs.end(), ys.begin(), ys.end(),
+           std::back_inserter(expected));
+
+    // Exactly the size of the result, writing past the end is an error.
+    std::vector<T> actual(expected.size());
+    T* actual_end = unsq_op(xs.data(), xs.data() + xs.size(), ys.data(),
+                            ys.data() + ys.size(), actual.data());
+    REQUIRE(actual_end == actual.data() + actual.size());
+    REQUIRE(expected == actual);
+  };
+
+  run([](auto... args) { return std::set_intersection(args...); },
+      [](auto... args) { return unsq::set_intersection<width>(args...); });
+  run([](auto... args) { return std::set_difference(args...); },
+      [](auto... args) { return unsq::set_difference<width>(args...); });
+  run([](auto... args) { return std::set_union(args...); },
+      [](auto... args) { return unsq::set_union<width>(args...); });
+}
+
+template <std::size_t byte_width, typename T>
+void set_operations_test_for_type() {
+  constexpr std::size_t width = byte_width / sizeof(T);
+
+  std::mt19937 g;
+
+  const std::size_t sizes[] = {0, 1, 2, width - 1, width, width + 1,
+                               3 * width, 10 * width + 3, 1000};
+
+  for (std::size_t size1 : sizes) {
+    for (std::size_t size2 : sizes) {
+      for (int percentage1 : {10, 50, 100}) {
+        for (int percentage2 : {10, 50, 100}) {
+          set_operations_test<width>(random_set<T>(g, size1, percentage1),
+                                     random_set<T>(g, size2, percentage2));
+        }
+      }
+    }
+  }
+
+  // Same elements.
+  const std::vector<T> xs = random_set<T>(g, 500, 50);
+  set_operations_test<width>(xs, xs);
+
+  // One range is far after the other.
+  std::vector<T> ys = random_set<T>(g, 500, 50);
+  for (T& y : ys) y += 10000;
+  set_operations_test<width>(xs, ys);
+  set_operations_test<width>(ys, xs);
+
+  // Very skewed sizes.
+  set_operations_test<width>(random_set<T>(g, 20000, 90),
+                             random_set<T>(g, 30, 1));
+  set_operations_test<width>(random_set<T>(g, 30, 1),
+                             random_set<T>(g, 20000, 90));
+}
+
+TEMPLATE_TEST_CASE("unsq.set_operations", "[unsq][simd][set_operations]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  set_operations_test_for_type<byte_width, std::int16_t>();
+  set_operations_test_for_type<byte_width, std::int32_t>();
+  set_operations_test_for_type<byte_width, std::uint32_t>();
+  set_operations_test_for_type<byte_width, std::int64_t>();
+}
+
+}  // namespace
+}  // namespace unsq
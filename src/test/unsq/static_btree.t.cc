@@ -0,0 +1,85 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unsq/static_btree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename T>
+void static_btree_test(const std::vector<T>& sorted, int max) {
+  const static_btree<T, width> tree(sorted.begin(), sorted.end());
+  REQUIRE(tree.size() == sorted.size());
+
+  for (int i = -1; i <= max + 1; ++i) {
+    const T v = static_cast<T>(i);
+    const auto expected = static_cast<std::size_t>(
+        std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+    REQUIRE(expected == tree.lower_bound(v));
+  }
+}
+
+template <std::size_t byte_width, typename T>
+void static_btree_test_for_type() {
+  constexpr std::size_t width = byte_width / sizeof(T);
+  constexpr int node_size = static_cast<int>(static_btree<T, width>::node_size);
+
+  // Up to 3 layers of nodes with all the edge cases on the way.
+  std::vector<int> sizes;
+  for (int size = 0; size != 300; ++size) sizes.push_back(size);
+  for (int layer : {node_size, node_size * (node_size + 1)}) {
+    for (int diff : {-1, 0, 1}) {
+      sizes.push_back(layer * (node_size + 1) + diff);
+      sizes.push_back(layer * 3 + diff);
+    }
+  }
+
+  for (int size : sizes) {
+    // Values have to fit in a char.
+    const int step = size / 100 + 1;
+
+    std::vector<T> duplicates(size);
+    for (int i = 0; i != size; ++i) duplicates[i] = static_cast<T>(i / step);
+    static_btree_test<width>(duplicates, (size - 1) / step);
+  }
+
+  std::vector<T> unique(1000);
+  for (int i = 0; i != 1000; ++i) unique[i] = static_cast<T>(i);
+  if constexpr (sizeof(T) > 1) static_btree_test<width>(unique, 1000);
+}
+
+TEMPLATE_TEST_CASE("unsq.static_btree", "[unsq][simd][static_btree]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  static_btree_test_for_type<byte_width, std::int8_t>();
+  static_btree_test_for_type<byte_width, std::uint16_t>();
+  static_btree_test_for_type<byte_width, std::int32_t>();
+  static_btree_test_for_type<byte_width, std::int64_t>();
+  static_btree_test_for_type<byte_width, float>();
+  static_btree_test_for_type<byte_width, double>();
+}
+
+}  // namespace
+}  // namespace unsq
@@ -24,6 +24,20 @@
 
 #include "simd/pack.h"
 
+// Pack widths in bytes that unsq algorithms are tested with.
+// clang-format off
+#ifdef __AVX512BW__
+#define UNSQ_TEST_BYTE_WIDTHS                        \
+  (std::integral_constant<std::size_t, 16>),         \
+  (std::integral_constant<std::size_t, 32>),         \
+  (std::integral_constant<std::size_t, 64>)
+#else
+#define UNSQ_TEST_BYTE_WIDTHS                        \
+  (std::integral_constant<std::size_t, 16>),         \
+  (std::integral_constant<std::size_t, 32>)
+#endif
+// clang-format on
+
 namespace unsq {
 
 constexpr auto page_alignment = std::align_val_t{simd::page_size()};
@@ -220,6 +234,12 @@ void one_range_test(Op op) {
   one_range_test_one_type<std::uint64_t>(op);
 }
 
+template <typename Op>
+void one_range_test_floating(Op op) {
+  one_range_test_one_type<float>(op);
+  one_range_test_one_type<double>(op);
+}
+
 }  // namespace unsq
 
 #endif  // TEST_UNSQ_TEST_INPUT_H_
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unsq/unique.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "test/catch.h"
+#include "test/unsq/test_input.h"
+
+namespace unsq {
+namespace {
+
+template <std::size_t width, typename I>
+void one_range_unique_test(I f, I l) {
+  using T = ValueType<I>;
+
+  auto run = [&] {
+    const std::vector<T> input(f, l);
+
+    std::vector<T> expected(f, l);
+    expected.erase(std::unique(expected.begin(), expected.end()),
+                   expected.end());
+
+    // Exactly the size of the result, writing past the end is an error.
+    std::vector<T> actual(expected.size());
+    T* actual_end = unsq::unique_copy<width>(f, l, actual.data());
+    REQUIRE(actual_end == actual.data() + actual.size());
+    REQUIRE(expected == actual);
+    REQUIRE(input == std::vector<T>(f, l));
+
+    I unique_end = unsq::unique<width>(f, l);
+    REQUIRE(expected == std::vector<T>(f, unique_end));
+  };
+
+  // No duplicates
+  for (I it = f; it != l; ++it) *it = static_cast<T>((it - f) % 100);
+  run();
+
+  // All the same
+  std::fill(f, l, T(1));
+  run();
+
+  // Runs of different lengths, sorted.
+  for (std::ptrdiff_t run_length : {2, 3, 7, 40}) {
+    for (I it = f; it != l; ++it) {
+      *it = static_cast<T>((it - f) / run_length % 100);
+    }
+    run();
+  }
+
+  // Random, not sorted.
+  std::mt19937 g;
+  std::uniform_int_distribution<int> dis(0, 2);
+  for (I it = f; it != l; ++it) *it = static_cast<T>(dis(g));
+  run();
+}
+
+TEMPLATE_TEST_CASE("unsq.unique", "[unsq][simd][unique]",
+                   UNSQ_TEST_BYTE_WIDTHS) {
+  constexpr std::size_t byte_width = TestType{};
+
+  one_range_test([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_unique_test<width>(f, l);
+  });
+
+  one_range_test_floating([](auto f, auto l) {
+    static constexpr std::size_t width =
+        byte_width / sizeof(ValueType<decltype(f)>);
+    one_range_unique_test<width>(f, l);
+  });
+}
+
+}  // namespace
+}  // namespace unsq
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UNSQ_COUNT_H_
+#define UNSQ_COUNT_H_
+
+#include <cstddef>
+#include <limits>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/find.h"
+#include "unsq/iteration.h"
+
+namespace unsq {
+namespace _count {
+
+// Full loads are accumulated into a pack of counters: true in vbool is all
+// ones, so subtracting it adds 1. This avoids a movemask + popcount per load.
+// Counters are flushed before they can overflow (every 255 loads for chars).
+// Partial loads are rare, they just popcount the top bits.
+template <std::size_t width, typename _I, typename PV>
+// require ContigiousIterator<_I> && VectorPredicate<PV,
+// equivalent<ValueType<I>>
+struct count_if_body {
+  using I = equivalent_iterator<_I>;
+  using T = ValueType<I>;
+  using pack = simd::pack<T, width>;
+  using vbool = simd::vbool_t<pack>;
+  using counter = simd::scalar_t<vbool>;
+
+  PV p;
+  vbool counters = simd::set_zero<vbool>();
+  counter loads_since_flush = 0;
+  std::ptrdiff_t flushed = 0;
+
+  explicit count_if_body(PV p) : p{p} {}
+
+  bool operator()(I from) {
+    const vbool test = p(simd::load<pack>(from));
+    counters = simd::sub_pairwise(counters, test);
+    if (++loads_since_flush == std::numeric_limits<counter>::max()) flush();
+    return false;
+  }
+
+  bool operator()(I from, simd::top_bits<vbool> ignore) {
+    const vbool test = p(simd::load<pack>(from));
+    flushed += simd::count_true(simd::get_top_bits(test, ignore));
+    return false;
+  }
+
+  void flush() {
+    for (counter x : simd::to_array(counters)) {
+      flushed += static_cast<std::ptrdiff_t>(x);
+    }
+    counters = simd::set_zero<vbool>();
+    loads_since_flush = 0;
+  }
+
+  std::ptrdiff_t result() {
+    flush();
+    return flushed;
+  }
+};
+
+}  // namespace _count
+
+template <std::size_t width, typename I, typename PV>
+// require ContigiousIterator<I> && VectorPredicate<PV, equivalent<ValueType<I>>
+std::ptrdiff_t count_if(I f, I l, PV p) {
+  _count::count_if_body<width, I, PV> body{p};
+  return iteration_aligned<width>(f, l, body).result();
+}
+
+template <std::size_t width, typename I, typename T>
+// require ContigiousIterator<I> && Convertible<T, ValueType<P>>
+std::ptrdiff_t count(I f, I l, const T& x) {
+  return unsq::count_if<width>(f, l, _find::equal_to<I, width>(x));
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_COUNT_H_
@@ -34,7 +34,7 @@ struct type_t {
 
 template <typename T>
 constexpr auto equivalent() {
-  if constexpr (std::is_integral_v<T>)
+  if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>)
     return type_t<T>{};
   else if constexpr (std::is_enum_v<T>)
     return type_t<std::underlying_type<T>>{};
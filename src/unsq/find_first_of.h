@@ -0,0 +1,125 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UNSQ_FIND_FIRST_OF_H_
+#define UNSQ_FIND_FIRST_OF_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/find.h"
+
+namespace unsq {
+namespace _find_first_of {
+
+// Up to this many values we compare with each one.
+// For bytes bigger sets are checked with a simd::byte_set.
+constexpr std::ptrdiff_t kMaxComparisons = 4;
+
+template <typename I, typename I2>
+auto as_equivalent(I2 it) {
+  return equivalent_cast(static_cast<ValueType<I>>(*it));
+}
+
+template <std::size_t width, std::size_t N, typename I, typename I2>
+auto equal_any(I2 set_f) {
+  using T = equivalent<ValueType<I>>;
+  using pack = simd::pack<T, width>;
+
+  std::array<pack, N> packs;
+  for (auto& x : packs) x = simd::set_all<pack>(as_equivalent<I>(set_f++));
+
+  return [packs](const pack& read) {
+    auto res = simd::equal_pairwise(read, packs[0]);
+    for (std::size_t i = 1; i != N; ++i) {
+      res = res | simd::equal_pairwise(read, packs[i]);
+    }
+    return res;
+  };
+}
+
+template <std::size_t width, typename I, typename I2>
+auto equal_any(I2 set_f, I2 set_l) {
+  using T = equivalent<ValueType<I>>;
+  using pack = simd::pack<T, width>;
+
+  std::vector<pack> packs;
+  for (; set_f != set_l; ++set_f) {
+    packs.push_back(simd::set_all<pack>(as_equivalent<I>(set_f)));
+  }
+
+  return [packs = std::move(packs)](const pack& read) {
+    auto res = simd::equal_pairwise(read, packs[0]);
+    for (std::size_t i = 1; i != packs.size(); ++i) {
+      res = res | simd::equal_pairwise(read, packs[i]);
+    }
+    return res;
+  };
+}
+
+template <std::size_t width, typename I, typename I2>
+auto in_byte_set(I2 set_f, I2 set_l) {
+  using T = equivalent<ValueType<I>>;
+  using pack = simd::pack<T, width>;
+  static_assert(sizeof(T) == 1);
+
+  const simd::byte_set<width> set(set_f, set_l);
+  return [set](const pack& read) {
+    return set.contains(simd::cast_to_unsigned(read));
+  };
+}
+
+}  // namespace _find_first_of
+
+template <std::size_t width, typename I, typename I2>
+// require ContigiousIterator<I> && ForwardIterator<I2> &&
+//         Convertible<ValueType<I2>, ValueType<I>>
+I find_first_of(I f, I l, I2 set_f, I2 set_l) {
+  using namespace _find_first_of;
+  using T = equivalent<ValueType<I>>;
+
+  const auto n = std::distance(set_f, set_l);
+
+  if constexpr (sizeof(T) == 1) {
+    if (n > kMaxComparisons) {
+      return unsq::find_if<width>(f, l, in_byte_set<width, I>(set_f, set_l));
+    }
+  }
+
+  switch (n) {
+    case 0:
+      return l;
+    case 1:
+      return unsq::find_if<width>(f, l, equal_any<width, 1, I>(set_f));
+    case 2:
+      return unsq::find_if<width>(f, l, equal_any<width, 2, I>(set_f));
+    case 3:
+      return unsq::find_if<width>(f, l, equal_any<width, 3, I>(set_f));
+    case 4:
+      return unsq::find_if<width>(f, l, equal_any<width, 4, I>(set_f));
+    default:
+      return unsq::find_if<width>(f, l, equal_any<width, I>(set_f, set_l));
+  }
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_FIND_FIRST_OF_H_
@@ -17,6 +17,9 @@
 #ifndef UNSQ_ITERATION_H_
 #define UNSQ_ITERATION_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "simd/pack.h"
 #include "unsq/drill_down.h"
 
@@ -87,6 +90,34 @@ P iteration_aligned(I _f, I _l, P p) {
   return p;
 }
 
+// Smaller chunks are not worth giving to a different thread.
+constexpr std::ptrdiff_t kMinPagesInChunk = 16;
+
+template <typename I>
+// require ContigiousIterator<I>
+std::vector<I> page_aligned_chunks(I f, I l, std::size_t max_chunks) {
+  auto* ptr = drill_down(f);
+  const std::ptrdiff_t n_in_page = simd::page_size() / sizeof(*ptr);
+  const std::ptrdiff_t size = l - f;
+  const std::ptrdiff_t n_pages = size / n_in_page + 1;
+  const std::ptrdiff_t max_n = static_cast<std::ptrdiff_t>(max_chunks);
+  const std::ptrdiff_t chunk =
+      std::max(kMinPagesInChunk, (n_pages + max_n - 1) / max_n) * n_in_page;
+
+  // All chunks but the first one begin on a page boundary.
+  std::ptrdiff_t boundary = (simd::end_of_page(ptr) - ptr) % n_in_page;
+
+  // Too small of a tail goes to the last chunk.
+  const std::ptrdiff_t min_chunk = kMinPagesInChunk * n_in_page;
+
+  std::vector<I> res{f};
+  for (boundary += chunk; size - boundary >= min_chunk; boundary += chunk) {
+    res.push_back(f + boundary);
+  }
+  res.push_back(l);
+  return res;
+}
+
 }  // namespace unsq
 
 #endif  // UNSQ_ITERATION_H_
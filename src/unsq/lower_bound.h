@@ -0,0 +1,108 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UNSQ_LOWER_BOUND_H_
+#define UNSQ_LOWER_BOUND_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/remove.h"
+
+namespace unsq {
+namespace _lower_bound {
+
+// Ranges bigger than this (in bytes) do k-ary steps.
+constexpr std::ptrdiff_t kKAryThreshold = 16 * 1024;
+
+// Number of pivots per k-ary step.
+constexpr std::ptrdiff_t kKAryPivots = 3;
+
+// Number of xs that are less than x.
+template <typename Pack>
+std::uint32_t count_less(const Pack& xs, const Pack& x) {
+  return simd::count_true(simd::get_top_bits(simd::greater_pairwise(x, xs)));
+}
+
+// Splits [f, l) into kKAryPivots + 1 parts and leaves only the one where the
+// lower bound is. Unlike in a binary search the pivot loads don't depend on
+// each other, so the cache misses overlap.
+template <typename P, typename T>
+// require P is T* or const T*
+void k_ary_step(P& f, P& l, const T& v) {
+  const std::ptrdiff_t step = (l - f) / (kKAryPivots + 1);
+
+  std::ptrdiff_t less = 0;
+  for (std::ptrdiff_t i = 1; i <= kKAryPivots; ++i) less += f[i * step] < v;
+
+  if (less != kKAryPivots) l = f + (less + 1) * step;
+  f += less * step + (less != 0);
+}
+
+}  // namespace _lower_bound
+
+// Lower bound with the same result as std::lower_bound with `<`.
+// Big ranges are cut with k-ary steps, then a branchless binary search
+// goes down to a pack and we count how many elements in it are less than
+// the value.
+template <std::size_t width, typename I, typename V>
+// require ContigiousIterator<I> && Convertible<V, ValueType<I>>
+I lower_bound(I _f, I _l, const V& v) {
+  using T = equivalent<ValueType<I>>;
+  using pack = simd::pack<T, width>;
+  constexpr auto n = static_cast<std::ptrdiff_t>(width);
+
+  auto [f, l] = unsq::drill_down_range(_f, _l);
+  auto* const original_f = f;
+  const T x = equivalent_cast(ValueType<I>(v));
+  const pack xs = simd::set_all<pack>(x);
+
+  while ((l - f) * static_cast<std::ptrdiff_t>(sizeof(T)) >
+         _lower_bound::kKAryThreshold) {
+    _lower_bound::k_ary_step(f, l, x);
+  }
+
+  // Everything before f is less than x, the lower bound is in [f, l].
+  std::ptrdiff_t len = l - f;
+  while (len > n) {
+    const std::ptrdiff_t half = len / 2;
+    f = f[half] < x ? f + half : f;
+    len -= half;
+  }
+  l = f + len;
+
+  // A pack ending at l can start before f.
+  if (l - original_f >= n) {
+    const pack loaded = simd::load_unaligned<pack>(l - n);
+    return unsq::undo_drill_down(_f,
+                                 l - n + _lower_bound::count_less(loaded, xs));
+  }
+
+  if (f == l) return unsq::undo_drill_down(_f, f);
+
+  // The whole range is smaller than a pack.
+  auto [safe, filter] = _remove::figure_out_safe_load<pack>(f, l);
+  const pack loaded = simd::load_unaligned<pack>(safe);
+  auto less = simd::get_top_bits(simd::greater_pairwise(xs, loaded)) & filter;
+  return unsq::undo_drill_down(_f, f + simd::count_true(less));
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_LOWER_BOUND_H_
@@ -0,0 +1,280 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UNSQ_MINMAX_ELEMENT_H_
+#define UNSQ_MINMAX_ELEMENT_H_
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "compiler/compiler_directives.h"
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/iteration.h"
+
+namespace unsq {
+namespace _minmax_element {
+
+// std::min_element and std::max_element return the first of equal elements,
+// std::minmax_element returns the last one for the max.
+enum class pick { min_first, max_first, max_last };
+
+template <pick how, typename T>
+bool better(const T& x, const T* x_pos, const T& best, const T* best_pos) {
+  if constexpr (how == pick::min_first) {
+    return x < best || (!(best < x) && x_pos < best_pos);
+  } else if constexpr (how == pick::max_first) {
+    return best < x || (!(x < best) && x_pos < best_pos);
+  } else {
+    return best < x || (!(x < best) && x_pos > best_pos);
+  }
+}
+
+template <pick how, typename Pack>
+simd::vbool_t<Pack> better(const Pack& xs, const Pack& best) {
+  if constexpr (how == pick::min_first) {
+    return simd::greater_pairwise(best, xs);
+  } else if constexpr (how == pick::max_first) {
+    return simd::greater_pairwise(xs, best);
+  } else {
+    return ~simd::greater_pairwise(best, xs);
+  }
+}
+
+template <pick how, typename Pack>
+Pack combine(const Pack& xs, const Pack& ys) {
+  if constexpr (how == pick::min_first) {
+    return simd::min_pairwise(xs, ys);
+  } else {
+    return simd::max_pairwise(xs, ys);
+  }
+}
+
+template <pick how, typename T>
+constexpr T identity() {
+  using limits = std::numeric_limits<T>;
+  if constexpr (how == pick::min_first) {
+    return limits::has_infinity ? limits::infinity() : limits::max();
+  } else {
+    return limits::has_infinity ? -limits::infinity() : limits::lowest();
+  }
+}
+
+// Position of the best element so far.
+template <typename I, typename T>
+struct found_t {
+  I pos;
+  T value;
+};
+
+// Comparing with the best and blending is a long dependency chain,
+// so we only do it once per block of kBlockLoads loads. Within a block loads
+// are just combined with min/max.
+//
+// Every lane keeps the best value it has seen and the number of the block it
+// came from. Block numbers have the same size as the elements, so for small
+// types we have to flush every few hundred blocks. Lanes with the best value
+// then search their block for the position and the lanes are reset to
+// the new best value. Block number 0 is reserved for "not updated".
+//
+// Lanes always compete with the flushed value and ties between lanes are
+// resolved by the position.
+//
+// Partial loads are not combined with anything, they are a block on their own.
+template <pick how, std::size_t width, typename _I>
+// require ContigiousIterator<_I> && TotallyOrdered<equivalent<ValueType<_I>>>
+struct tracker {
+  using I = equivalent_iterator<_I>;
+  using T = equivalent<ValueType<_I>>;
+  using pack = simd::pack<T, width>;
+  using vbool = simd::vbool_t<pack>;
+  using block_number = simd::scalar_t<vbool>;
+  using found = found_t<I, T>;
+
+  static constexpr std::size_t kBlockLoads = 8;
+
+  found res;
+
+  pack best;
+  vbool best_block = simd::set_zero<vbool>();
+
+  pack block = simd::set_all<pack>(identity<how, T>());
+  std::size_t loads_in_block = 0;
+  std::size_t loads_in_last_block = 0;
+
+  I chunk_f;
+  vbool cur_block = simd::set_zero<vbool>();
+  block_number blocks_since_flush = 0;
+
+  explicit tracker(I f)
+      : res{f, *f}, best{simd::set_all<pack>(*f)}, chunk_f{f} {}
+
+  // First (or last for pick::max_last) element in a block, equal to x.
+  static I find_in_block(const T& x, I lane_f, std::size_t n) {
+    I pos = lane_f;
+    for (std::size_t i = 0; i != n; ++i, lane_f += width) {
+      if (*lane_f < x || x < *lane_f) continue;
+      pos = lane_f;
+      if constexpr (how != pick::max_last) break;
+    }
+    return pos;
+  }
+
+  // Everything is passed by value, so that the tracker doesn't escape and
+  // can stay in registers.
+  static ALGO_NOINLINE found resolve(found res, pack best, vbool best_block,
+                                     I chunk_f, block_number last_block,
+                                     std::size_t loads_in_last_block) {
+    const pack reduced = simd::reduce(best, [](const pack& x, const pack& y) {
+      return combine<how>(x, y);
+    });
+    const vbool updated =
+        ~simd::equal_pairwise(best_block, simd::set_zero<vbool>());
+    auto candidates =
+        simd::get_top_bits(simd::equal_pairwise(best, reduced) & updated);
+    if (!candidates) return res;
+
+    const auto values = simd::to_array(best);
+    const auto blocks = simd::to_array(best_block);
+
+    while (const std::optional i = simd::first_true(candidates)) {
+      candidates = simd::ignore_first_n(candidates, *i + 1);
+
+      I pos = find_in_block(
+          values[*i], chunk_f + (blocks[*i] - 1) * kBlockLoads * width + *i,
+          blocks[*i] == last_block ? loads_in_last_block : kBlockLoads);
+
+      if (better<how>(values[*i], pos, res.value, res.pos)) {
+        res = found{pos, values[*i]};
+      }
+    }
+
+    return res;
+  }
+
+  void commit(const vbool& is_better) {
+    cur_block = simd::add_pairwise(cur_block, simd::set_all<vbool>(1));
+    ++blocks_since_flush;
+
+    best = simd::blend(best, block, is_better);
+    best_block = simd::blend(best_block, cur_block, is_better);
+
+    block = simd::set_all<pack>(identity<how, T>());
+    loads_in_last_block = loads_in_block;
+    loads_in_block = 0;
+  }
+
+  void flush() {
+    if (loads_in_block) commit(better<how>(block, best));
+
+    res = resolve(res, best, best_block, chunk_f, blocks_since_flush,
+                  loads_in_last_block);
+
+    best = simd::set_all<pack>(res.value);
+    best_block = simd::set_zero<vbool>();
+    cur_block = simd::set_zero<vbool>();
+    blocks_since_flush = 0;
+  }
+
+  bool operator()(I from) {
+    if (!blocks_since_flush && !loads_in_block) chunk_f = from;
+
+    block = combine<how>(block, simd::load<pack>(from));
+    if (++loads_in_block != kBlockLoads) return false;
+
+    commit(better<how>(block, best));
+    if (blocks_since_flush == std::numeric_limits<block_number>::max()) {
+      flush();
+    }
+    return false;
+  }
+
+  bool operator()(I from, simd::top_bits<vbool> ignore) {
+    flush();
+    chunk_f = from;
+
+    block = simd::load<pack>(from);
+    loads_in_block = 1;
+    commit(better<how>(block, best) & simd::spread_top_bits(ignore));
+    flush();
+    return false;
+  }
+
+  I result() {
+    flush();
+    return res.pos;
+  }
+};
+
+// One pass for both, the load is shared.
+template <std::size_t width, typename _I>
+struct minmax_body {
+  using I = equivalent_iterator<_I>;
+
+  tracker<pick::min_first, width, _I> min;
+  tracker<pick::max_last, width, _I> max;
+
+  explicit minmax_body(I f) : min{f}, max{f} {}
+
+  template <typename... Ignore>
+  bool operator()(I from, Ignore... ignore) {
+    min(from, ignore...);
+    max(from, ignore...);
+    return false;
+  }
+};
+
+template <pick how, std::size_t width, typename I>
+I select_element(I f, I l) {
+  if (f == l) return l;
+
+  tracker<how, width, I> body{drill_down(f)};
+  return undo_drill_down(f, iteration_aligned<width>(f, l, body).result());
+}
+
+}  // namespace _minmax_element
+
+template <std::size_t width, typename I>
+// require ContigiousIterator<I> && TotallyOrdered<equivalent<ValueType<I>>>
+I min_element(I f, I l) {
+  return _minmax_element::select_element<_minmax_element::pick::min_first,
+                                         width>(f, l);
+}
+
+template <std::size_t width, typename I>
+// require ContigiousIterator<I> && TotallyOrdered<equivalent<ValueType<I>>>
+I max_element(I f, I l) {
+  return _minmax_element::select_element<_minmax_element::pick::max_first,
+                                         width>(f, l);
+}
+
+template <std::size_t width, typename I>
+// require ContigiousIterator<I> && TotallyOrdered<equivalent<ValueType<I>>>
+std::pair<I, I> minmax_element(I f, I l) {
+  if (f == l) return {l, l};
+
+  _minmax_element::minmax_body<width, I> body{drill_down(f)};
+  body = iteration_aligned<width>(f, l, body);
+  return {undo_drill_down(f, body.min.result()),
+          undo_drill_down(f, body.max.result())};
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_MINMAX_ELEMENT_H_
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UNSQ_MISMATCH_H_
+#define UNSQ_MISMATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+
+namespace unsq {
+namespace _mismatch {
+
+// Index of the first mismatch or n.
+// Unlike strmismatch the size is known, so no need to look at page boundaries:
+// the last pack is loaded from the end, overlapping with the already compared
+// (equal) elements. If there isn't a full pack, try a smaller one.
+template <std::size_t width, typename T>
+std::ptrdiff_t mismatch_offset(const T* x, const T* y, std::ptrdiff_t n) {
+  using pack = simd::pack<T, width>;
+  constexpr std::ptrdiff_t w = static_cast<std::ptrdiff_t>(width);
+
+  if (n < w) {
+    if constexpr (sizeof(pack) > 16) {
+      return mismatch_offset<width / 2>(x, y, n);
+    } else {
+      std::ptrdiff_t i = 0;
+      while (i != n && x[i] == y[i]) ++i;
+      return i;
+    }
+  }
+
+  auto equal_pairwise = [&](std::ptrdiff_t i) {
+    const pack xs = simd::load_unaligned<pack>(x + i);
+    const pack ys = simd::load_unaligned<pack>(y + i);
+    return simd::equal_pairwise(xs, ys);
+  };
+
+  auto first_mismatch = [&](std::ptrdiff_t i) {
+    return simd::first_true(simd::get_top_bits(~equal_pairwise(i)));
+  };
+
+  std::ptrdiff_t i = 0;
+
+  // Most of the time nothing is found - check 4 packs at once.
+  for (; i + 4 * w < n; i += 4 * w) {
+    const auto all_equal = equal_pairwise(i) & equal_pairwise(i + w) &
+                           equal_pairwise(i + 2 * w) &
+                           equal_pairwise(i + 3 * w);
+    if (!simd::all_true(simd::get_top_bits(all_equal))) break;
+  }
+
+  for (; i + w < n; i += w) {
+    if (const std::optional found = first_mismatch(i)) {
+      return i + static_cast<std::ptrdiff_t>(*found);
+    }
+  }
+
+  i = n - w;
+  const std::optional found = first_mismatch(i);
+  return found ? i + static_cast<std::ptrdiff_t>(*found) : n;
+}
+
+// Types without an equivalent (records) are compared as bytes.
+// Only valid if equal objects have equal bytes: no padding, no floats.
+template <typename T>
+constexpr bool compare_as_bytes() {
+  return std::is_same_v<decltype(_drill_down::equivalent<T>()),
+                        _drill_down::error_t>;
+}
+
+template <typename I>
+const std::uint8_t* as_bytes(I it) {
+  return reinterpret_cast<const std::uint8_t*>(&*it);
+}
+
+}  // namespace _mismatch
+
+// For types that are compared as bytes, width is in bytes.
+template <std::size_t width, typename I1, typename I2>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         (same<equivalent<ValueType<I1>>, equivalent<ValueType<I2>>> ||
+//          same<ValueType<I1>, ValueType<I2>> &&
+//          HasUniqueObjectRepresentations<ValueType<I1>>)
+std::pair<I1, I2> mismatch(I1 f1, I1 l1, I2 f2) {
+  using T = ValueType<I1>;
+  if (f1 == l1) return {f1, f2};
+
+  const std::ptrdiff_t n = l1 - f1;
+
+  if constexpr (_mismatch::compare_as_bytes<T>()) {
+    static_assert(std::is_same_v<T, ValueType<I2>>);
+    static_assert(std::has_unique_object_representations_v<T>);
+
+    constexpr std::ptrdiff_t size = static_cast<std::ptrdiff_t>(sizeof(T));
+    const std::ptrdiff_t offset =
+        _mismatch::mismatch_offset<width>(_mismatch::as_bytes(f1),
+                                          _mismatch::as_bytes(f2), n * size) /
+        size;
+    return {f1 + offset, f2 + offset};
+  } else {
+    static_assert(std::is_same_v<equivalent<T>, equivalent<ValueType<I2>>>);
+
+    const std::ptrdiff_t offset =
+        _mismatch::mismatch_offset<width>(drill_down(f1), drill_down(f2), n);
+    return {f1 + offset, f2 + offset};
+  }
+}
+
+template <std::size_t width, typename I1, typename I2>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         same<equivalent<ValueType<I1>>, equivalent<ValueType<I2>>>
+bool equal(I1 f1, I1 l1, I2 f2) {
+  return unsq::mismatch<width>(f1, l1, f2).first == l1;
+}
+
+template <std::size_t width, typename I1, typename I2>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         same<equivalent<ValueType<I1>>, equivalent<ValueType<I2>>>
+bool equal(I1 f1, I1 l1, I2 f2, I2 l2) {
+  if (l1 - f1 != l2 - f2) return false;
+  return unsq::equal<width>(f1, l1, f2);
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_MISMATCH_H_
@@ -2,36 +2,75 @@
 #define UNSQ_REDUCE_H_
 
 #include <optional>
+#include <vector>
 
+#include "algo/thread_pool.h"
 #include "simd/pack.h"
 #include "unsq/drill_down.h"
 #include "unsq/iteration.h"
 
 namespace unsq {
+namespace _reduce {
 
-template <std::size_t width, typename I, typename T, typename Op>
-// require ContigiousIterator<I> &&
-//         CommutaiveAssociativeTransformation<Op,
-//         pack<equivalent<ValueType<I>>, width>> && same<equivalent<T>,
-//         equivalent<ValueType<I>>
-ValueType<I> reduce(I f, I l, const T& zero, Op op) {
-  using pack = simd::pack<equivalent<ValueType<I>>, width>;
-  const auto zeroes = simd::set_all<pack>(equivalent_cast(zero));
-
+template <std::size_t width, typename I, typename Pack, typename Op>
+Pack reduce_to_pack(I f, I l, const Pack& zeroes, Op op) {
   auto res = zeroes;
 
   auto body = [&](equivalent_iterator<I> from, auto... ignore) mutable {
-    auto cur = simd::load<pack>(from);
+    auto cur = simd::load<Pack>(from);
     cur = simd::replace_ignored(cur, ignore..., zeroes);
     res = op(res, cur);
     return false;
   };
 
   iteration_aligned<width>(f, l, body);
+  return res;
+}
 
+template <typename T, typename Pack, typename Op>
+T reduce_pack(Pack res, Op op) {
   res = simd::reduce(res, op);
   auto as_array = simd::to_array(res);
-  return from_equivalent_cast<ValueType<I>>(as_array[0]);
+  return from_equivalent_cast<T>(as_array[0]);
+}
+
+}  // namespace _reduce
+
+template <std::size_t width, typename I, typename T, typename Op>
+// require ContigiousIterator<I> &&
+//         CommutaiveAssociativeTransformation<Op,
+//         pack<equivalent<ValueType<I>>, width>> && same<equivalent<T>,
+//         equivalent<ValueType<I>>
+ValueType<I> reduce(I f, I l, const T& zero, Op op) {
+  using pack = simd::pack<equivalent<ValueType<I>>, width>;
+  const auto zeroes = simd::set_all<pack>(equivalent_cast(zero));
+
+  auto res = _reduce::reduce_to_pack<width>(f, l, zeroes, op);
+  return _reduce::reduce_pack<ValueType<I>>(res, op);
+}
+
+// Splits the range into page aligned chunks, every chunk is reduced
+// to a pack on it's own thread, then the packs are combined.
+template <std::size_t width, typename I, typename T, typename Op>
+// require ContigiousIterator<I> &&
+//         CommutaiveAssociativeTransformation<Op,
+//         pack<equivalent<ValueType<I>>, width>> && same<equivalent<T>,
+//         equivalent<ValueType<I>>
+ValueType<I> reduce(algo::thread_pool& pool, I f, I l, const T& zero, Op op) {
+  using pack = simd::pack<equivalent<ValueType<I>>, width>;
+  const auto zeroes = simd::set_all<pack>(equivalent_cast(zero));
+
+  const std::vector<I> chunks = page_aligned_chunks(f, l, pool.size());
+  std::vector<pack> partial(chunks.size() - 1, zeroes);
+
+  pool.for_each_index(partial.size(), [&](std::size_t i) {
+    partial[i] =
+        _reduce::reduce_to_pack<width>(chunks[i], chunks[i + 1], zeroes, op);
+  });
+
+  auto res = zeroes;
+  for (const auto& x : partial) res = op(res, x);
+  return _reduce::reduce_pack<ValueType<I>>(res, op);
 }
 
 template <std::size_t width, typename I, typename T>
@@ -63,6 +102,36 @@ std::optional<ValueType<I>> max_value(I f, I l) {
       f, l, *f, [](auto xs, auto ys) { return simd::max_pairwise(xs, ys); });
 }
 
+template <std::size_t width, typename I, typename T>
+ValueType<I> reduce(algo::thread_pool& pool, I f, I l, const T& zero) {
+  return reduce<width>(pool, f, l, zero, [](auto xs, auto ys) {
+    return simd::add_pairwise(xs, ys);
+  });
+}
+
+template <std::size_t width, typename I>
+ValueType<I> reduce(algo::thread_pool& pool, I f, I l) {
+  return reduce<width>(pool, f, l, ValueType<I>{});
+}
+
+template <std::size_t width, typename I>
+std::optional<ValueType<I>> min_value(algo::thread_pool& pool, I f, I l) {
+  if (f == l) return std::nullopt;
+
+  return reduce<width>(pool, f, l, *f, [](auto xs, auto ys) {
+    return simd::min_pairwise(xs, ys);
+  });
+}
+
+template <std::size_t width, typename I>
+std::optional<ValueType<I>> max_value(algo::thread_pool& pool, I f, I l) {
+  if (f == l) return std::nullopt;
+
+  return reduce<width>(pool, f, l, *f, [](auto xs, auto ys) {
+    return simd::max_pairwise(xs, ys);
+  });
+}
+
 }  // namespace unsq
 
 #endif  // UNSQ_REDUCE_H_
@@ -17,8 +17,16 @@
 #ifndef UNSQ_REMOVE_H_
 #define UNSQ_REMOVE_H_
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "algo/thread_pool.h"
 #include "simd/pack.h"
 #include "unsq/drill_down.h"
+#include "unsq/iteration.h"
 
 namespace unsq {
 namespace _remove {
@@ -42,6 +50,84 @@ std::pair<T*, simd::top_bits<simd::vbool_t<Pack>>> figure_out_safe_load(T* f, T*
   return {f, simd::ignore_last_n_mask<vbool>(f + width - l)};
 }
 
+// Moves survivors of every chunk [chunks[i], ends[i]) to [outs[i], outs[i + 1]).
+//
+// The destination can overlap survivors of the previous chunks that were
+// not moved yet, so those have to be waited for. The pool gives out indexes
+// in order - we only wait for the chunks that some thread already started.
+// If a lot of elements are removed the chunks don't overlap and are moved
+// in parallel, otherwise this degrades to moving one chunk after another.
+template <typename I>
+void move_chunks(algo::thread_pool& pool, const std::vector<I>& chunks,
+                 const std::vector<I>& ends, const std::vector<I>& outs) {
+  const std::size_t n = ends.size();
+  std::vector<std::atomic<bool>> done(n);
+
+  pool.for_each_index(n, [&](std::size_t i) {
+    for (std::size_t k = 0; k < i; ++k) {
+      const bool overlap = chunks[k] < outs[i + 1] && outs[i] < ends[k];
+      if (!overlap) continue;
+      while (!done[k].load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+
+    if (chunks[i] != outs[i]) std::move(chunks[i], ends[i], outs[i]);
+    done[i].store(true, std::memory_order_release);
+  });
+}
+
+// Copies elements selected by the mmask to a different buffer.
+//
+// Unlike remove, the output only has space for the result, so a full pack
+// store is only possible if the stores after it are going to overwrite
+// the garbage. We look one pack ahead to see if this is the case and
+// otherwise store exactly the selected elements.
+template <std::size_t width, typename I, typename O, typename GetMmask>
+O copy_selected(I _f, I _l, O _o, GetMmask get_mmask) {
+  using T = equivalent<ValueType<I>>;
+  static_assert(std::is_same_v<T, equivalent<ValueType<O>>>);
+
+  using pack = simd::pack<T, width>;
+
+  auto [f, l] = unsq::drill_down_range(_f, _l);
+  T* o = unsq::drill_down(_o);
+
+  if (l - f >= static_cast<std::ptrdiff_t>(width)) {
+    pack ts = simd::load_unaligned<pack>(f);
+    auto mmask = get_mmask(ts);
+    f += width;
+
+    while (l - f >= static_cast<std::ptrdiff_t>(width)) {
+      const pack next_ts = simd::load_unaligned<pack>(f);
+      const auto next_mmask = get_mmask(next_ts);
+
+      if (simd::count_true(mmask) + simd::count_true(next_mmask) >= width) {
+        o = simd::compress_store_unsafe(o, ts, mmask);
+      } else {
+        o = simd::compress_store_exact(o, ts, mmask);
+      }
+
+      ts = next_ts;
+      mmask = next_mmask;
+      f += width;
+    }
+
+    o = simd::compress_store_exact(o, ts, mmask);
+  }
+
+  if (f == l) return unsq::undo_drill_down(_o, o);
+
+  auto [safe, mmask_filter] = figure_out_safe_load<pack>(f, l);
+
+  const pack ts = simd::load_unaligned<pack>(safe);
+  auto mmask = get_mmask(ts);
+  mmask &= mmask_filter;
+
+  o = simd::compress_store_exact(o, ts, mmask);
+  return unsq::undo_drill_down(_o, o);
+}
+
 }  // namespace _remove
 
 template <std::size_t width, typename I, typename PV>
@@ -71,6 +157,9 @@ I remove_if(I _f, I _l, PV p) {
     f += width;
   }
 
+  // Not reading past l: in parallel remove it's somebody else's chunk.
+  if (f == l) return unsq::undo_drill_down(_f, o);
+
   auto [safe, mmask_filter] = _remove::figure_out_safe_load<pack>(f, l);
 
   const pack ts = simd::load_unaligned<pack>(safe);
@@ -81,6 +170,29 @@ I remove_if(I _f, I _l, PV p) {
   return unsq::undo_drill_down(_f, o);
 }
 
+// Every page aligned chunk is compacted in place on it's own thread,
+// then an exclusive scan of survivor counts gives where each chunk goes.
+// The result is the same as for the serial version.
+template <std::size_t width, typename I, typename PV>
+// require ContigiousIterator<I> && VectorPredicate<PV, equivalent<ValueType<I>>
+I remove_if(algo::thread_pool& pool, I f, I l, PV p) {
+  const std::vector<I> chunks = page_aligned_chunks(f, l, pool.size());
+  const std::size_t n = chunks.size() - 1;
+
+  std::vector<I> ends(n);
+  pool.for_each_index(n, [&](std::size_t i) {
+    ends[i] = unsq::remove_if<width>(chunks[i], chunks[i + 1], p);
+  });
+
+  std::vector<I> outs(n + 1, f);
+  for (std::size_t i = 0; i != n; ++i) {
+    outs[i + 1] = outs[i] + (ends[i] - chunks[i]);
+  }
+
+  _remove::move_chunks(pool, chunks, ends, outs);
+  return outs.back();
+}
+
 template <std::size_t width, typename I, typename T>
 I remove(I f, I l, const T& x) {
   using U = equivalent<ValueType<I>>;
@@ -93,6 +205,54 @@ I remove(I f, I l, const T& x) {
   });
 }
 
+template <std::size_t width, typename I, typename O, typename PV>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         VectorPredicate<PV, equivalent<ValueType<I>>
+O copy_if(I f, I l, O o, PV p) {
+  using pack = simd::pack<equivalent<ValueType<I>>, width>;
+
+  return _remove::copy_selected<width>(f, l, o, [&](const pack& ts) {
+    return simd::get_top_bits(p(ts));
+  });
+}
+
+template <std::size_t width, typename I, typename O, typename PV>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         VectorPredicate<PV, equivalent<ValueType<I>>
+O remove_copy_if(I f, I l, O o, PV p) {
+  using pack = simd::pack<equivalent<ValueType<I>>, width>;
+
+  return _remove::copy_selected<width>(f, l, o, [&](const pack& ts) {
+    // p marks trues to remove. Negating the vbool, not the top bits:
+    // there should be no set bits outside of the pack.
+    return simd::get_top_bits(~p(ts));
+  });
+}
+
+template <std::size_t width, typename I, typename O, typename T>
+O remove_copy(I f, I l, O o, const T& x) {
+  using U = equivalent<ValueType<I>>;
+  using pack = simd::pack<U, width>;
+
+  auto xs = simd::set_all<pack>((U)x);
+
+  return unsq::remove_copy_if<width>(f, l, o, [&](const pack& read) {
+    return simd::equal_pairwise(read, xs);
+  });
+}
+
+template <std::size_t width, typename I, typename T>
+I remove(algo::thread_pool& pool, I f, I l, const T& x) {
+  using U = equivalent<ValueType<I>>;
+  using pack = simd::pack<U, width>;
+
+  auto xs = simd::set_all<pack>((U)x);
+
+  return unsq::remove_if<width>(pool, f, l, [&](const pack& read) {
+    return simd::equal_pairwise(read, xs);
+  });
+}
+
 }  // namespace unsq
 
 #endif  // UNSQ_REMOVE_H_
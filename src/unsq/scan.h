@@ -0,0 +1,104 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UNSQ_SCAN_H_
+#define UNSQ_SCAN_H_
+
+#include <type_traits>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+
+namespace unsq {
+namespace _scan {
+
+// Every pack is scanned in a register, then the last element of the
+// previous result is added to all elements.
+// For an exclusive scan we subtract the input back.
+template <std::size_t width, bool exclusive, typename I, typename O, typename T>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         same<ValueType<I>, ValueType<O>> && Integral<ValueType<I>>
+O scan(I _f, I _l, O _o, const T& init) {
+  using U = equivalent<ValueType<I>>;
+  using pack = simd::pack<U, width>;
+
+  static_assert(std::is_integral_v<ValueType<I>>);
+  static_assert(std::is_same_v<U, equivalent<ValueType<O>>>);
+
+  auto [f, l] = drill_down_range(_f, _l);
+  auto* o = drill_down(_o);
+
+  auto add = [](const pack& x, const pack& y) {
+    return simd::add_pairwise(x, y);
+  };
+
+  pack carry = simd::set_all<pack>(static_cast<U>(init));
+
+  for (; l - f >= static_cast<std::ptrdiff_t>(width); f += width, o += width) {
+    const pack xs = simd::load_unaligned<pack>(f);
+    const pack sums = add(simd::inclusive_scan(xs, add), carry);
+
+    if constexpr (exclusive) {
+      simd::store_unaligned(o, simd::sub_pairwise(sums, xs));
+    } else {
+      simd::store_unaligned(o, sums);
+    }
+    carry = simd::broadcast_last(sums);
+  }
+
+  U sum = simd::to_array(carry)[0];
+  for (; f != l; ++f, ++o) {
+    const U x = *f;
+    if constexpr (exclusive) {
+      *o = sum;
+      sum = static_cast<U>(sum + x);
+    } else {
+      sum = static_cast<U>(sum + x);
+      *o = sum;
+    }
+  }
+
+  return undo_drill_down(_o, o);
+}
+
+}  // namespace _scan
+
+template <std::size_t width, typename I, typename O>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         same<ValueType<I>, ValueType<O>> && Integral<ValueType<I>>
+O inclusive_scan(I f, I l, O o) {
+  return _scan::scan<width, /*exclusive*/ false>(f, l, o, ValueType<I>{0});
+}
+
+template <std::size_t width, typename I, typename O, typename T>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         same<ValueType<I>, ValueType<O>> && Integral<ValueType<I>> &&
+//         Convertible<T, ValueType<I>>
+O inclusive_scan(I f, I l, O o, const T& init) {
+  return _scan::scan<width, /*exclusive*/ false>(f, l, o, init);
+}
+
+template <std::size_t width, typename I, typename O, typename T>
+// require ContigiousIterator<I> && ContigiousIterator<O> &&
+//         same<ValueType<I>, ValueType<O>> && Integral<ValueType<I>> &&
+//         Convertible<T, ValueType<I>>
+O exclusive_scan(I f, I l, O o, const T& init) {
+  return _scan::scan<width, /*exclusive*/ true>(f, l, o, init);
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_SCAN_H_
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UNSQ_SEARCH_H_
+#define UNSQ_SEARCH_H_
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/mismatch.h"
+
+namespace unsq {
+namespace _search {
+
+// Looks for the first and the last elements of the needle at the same time:
+// candidates are positions where both match, they are verified with mismatch.
+// Positions [f, l) are candidates, the haystack goes till l + m - 1.
+template <std::size_t width, typename T>
+const T* search_candidates(const T* f, const T* l, const T* needle,
+                           std::ptrdiff_t m) {
+  using pack = simd::pack<T, width>;
+  using vbool = simd::vbool_t<pack>;
+  constexpr std::ptrdiff_t w = static_cast<std::ptrdiff_t>(width);
+
+  auto is_match = [&](const T* candidate) {
+    if (m <= 2) return true;
+    const T* middle = candidate + 1;
+    const std::ptrdiff_t middle_size = m - 2;
+    return _mismatch::mismatch_offset<width>(middle, needle + 1,
+                                             middle_size) == middle_size;
+  };
+
+  if (l - f < w) {
+    if constexpr (sizeof(pack) > 16) {
+      return search_candidates<width / 2>(f, l, needle, m);
+    } else {
+      for (; f != l; ++f) {
+        if (*f == needle[0] && f[m - 1] == needle[m - 1] && is_match(f)) {
+          return f;
+        }
+      }
+      return l;
+    }
+  }
+
+  const pack first = simd::set_all<pack>(needle[0]);
+  const pack last = simd::set_all<pack>(needle[m - 1]);
+
+  auto check = [&](const T* from, simd::top_bits<vbool> ignore) -> const T* {
+    const vbool first_test =
+        simd::equal_pairwise(simd::load_unaligned<pack>(from), first);
+    const vbool last_test =
+        simd::equal_pairwise(simd::load_unaligned<pack>(from + m - 1), last);
+
+    auto mmask = simd::get_top_bits(first_test & last_test, ignore);
+    while (const std::optional pos = simd::first_true(mmask)) {
+      if (is_match(from + *pos)) return from + *pos;
+      mmask = simd::ignore_first_n(mmask, *pos + 1);
+    }
+    return nullptr;
+  };
+
+  const T* cur = f;
+  for (; l - cur > w; cur += w) {
+    if (const T* found = check(cur, simd::ignore_first_n_mask<vbool>(0))) {
+      return found;
+    }
+  }
+
+  // Last pack overlaps with the already checked positions.
+  const T* from = l - w;
+  const auto checked = static_cast<std::uint32_t>(cur - from);
+  const T* found = check(from, simd::ignore_first_n_mask<vbool>(checked));
+  return found ? found : l;
+}
+
+}  // namespace _search
+
+template <std::size_t width, typename I1, typename I2>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         same<equivalent<ValueType<I1>>, equivalent<ValueType<I2>>>
+I1 search(I1 f, I1 l, I2 needle_f, I2 needle_l) {
+  static_assert(std::is_same_v<equivalent<ValueType<I1>>,
+                               equivalent<ValueType<I2>>>);
+
+  const std::ptrdiff_t m = needle_l - needle_f;
+  if (m == 0) return f;
+  if (l - f < m) return l;
+
+  const auto* haystack = drill_down(f);
+  const auto* candidates_l = haystack + (l - f) - m + 1;
+
+  const auto* found = _search::search_candidates<width>(
+      haystack, candidates_l, drill_down(needle_f), m);
+
+  if (found == candidates_l) return l;
+  return undo_drill_down(f, found);
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_SEARCH_H_
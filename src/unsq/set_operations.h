@@ -0,0 +1,284 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UNSQ_SET_OPERATIONS_H_
+#define UNSQ_SET_OPERATIONS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "algo/binary_search_biased.h"
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+
+// All of the set operations here expect strictly increasing ranges of
+// integers (sets, no duplicates). For those the results are the same as for
+// the std versions.
+
+namespace unsq {
+namespace _set_operations {
+
+// If one range is this many times bigger than the other, it's cheaper to
+// look up every element of the smaller one than to go through both.
+constexpr std::ptrdiff_t kSkewedRatio = 16;
+
+inline bool skewed(std::ptrdiff_t n1, std::ptrdiff_t n2) {
+  return n1 > n2 * kSkewedRatio || n2 > n1 * kSkewedRatio;
+}
+
+template <typename Pack, std::size_t... r>
+simd::vbool_t<Pack> any_equal_impl(const Pack& xs, const Pack& ys,
+                                   std::index_sequence<r...>) {
+  return (simd::equal_pairwise(xs, ys) | ... |
+          simd::equal_pairwise(xs, simd::rotate_elements_right<r + 1>(ys)));
+}
+
+// Lane i is true if xs[i] is equal to any of the ys.
+// Compares xs against all rotations of ys.
+template <typename Pack>
+simd::vbool_t<Pack> any_equal(const Pack& xs, const Pack& ys) {
+  return any_equal_impl(xs, ys,
+                        std::make_index_sequence<simd::size_v<Pack> - 1>{});
+}
+
+// Same trick as in _remove::copy_selected: the output only has space for the
+// result, so we store the full pack only if the next store overwrites the
+// garbage after it.
+template <typename Pack>
+struct exact_writer {
+  using T = simd::scalar_t<Pack>;
+  using mmask = simd::top_bits<simd::vbool_t<Pack>>;
+
+  T* o;
+  Pack pending = simd::set_zero<Pack>();
+  mmask pending_mmask{0};
+
+  explicit exact_writer(T* o) : o{o} {}
+
+  void push(const Pack& xs, mmask selected) {
+    if (simd::count_true(pending_mmask) + simd::count_true(selected) >=
+        simd::size_v<Pack>) {
+      o = simd::compress_store_unsafe(o, pending, pending_mmask);
+    } else {
+      o = simd::compress_store_exact(o, pending, pending_mmask);
+    }
+    pending = xs;
+    pending_mmask = selected;
+  }
+
+  T* finish() { return simd::compress_store_exact(o, pending, pending_mmask); }
+};
+
+template <typename T>
+T* intersection_galloping(const T* f1, const T* l1, const T* f2, const T* l2,
+                          T* o) {
+  if (l1 - f1 > l2 - f2) {
+    std::swap(f1, f2);
+    std::swap(l1, l2);
+  }
+
+  for (; f1 != l1; ++f1) {
+    f2 = algo::lower_bound_biased(f2, l2, *f1);
+    if (f2 == l2) break;
+    if (*f2 == *f1) *o++ = *f1;
+  }
+  return o;
+}
+
+template <typename T>
+T* difference_galloping(const T* f1, const T* l1, const T* f2, const T* l2,
+                        T* o) {
+  if (l1 - f1 <= l2 - f2) {
+    for (; f1 != l1; ++f1) {
+      f2 = algo::lower_bound_biased(f2, l2, *f1);
+      if (f2 == l2) break;
+      if (*f2 != *f1) *o++ = *f1;
+    }
+    return std::copy(f1, l1, o);
+  }
+
+  for (; f2 != l2; ++f2) {
+    const T* m = algo::lower_bound_biased(f1, l1, *f2);
+    o = std::copy(f1, m, o);
+    f1 = m;
+    if (f1 == l1) return o;
+    if (*f1 == *f2) ++f1;
+  }
+  return std::copy(f1, l1, o);
+}
+
+template <typename T>
+T* union_galloping(const T* f1, const T* l1, const T* f2, const T* l2,
+                   T* o) {
+  if (l1 - f1 < l2 - f2) {
+    std::swap(f1, f2);
+    std::swap(l1, l2);
+  }
+
+  for (; f2 != l2; ++f2) {
+    const T* m = algo::lower_bound_biased(f1, l1, *f2);
+    o = std::copy(f1, m, o);
+    f1 = m;
+    if (f1 != l1 && *f1 == *f2) ++f1;
+    *o++ = *f2;
+  }
+  return std::copy(f1, l1, o);
+}
+
+template <typename T>
+T* union_linear(const T* f1, const T* l1, const T* f2, const T* l2,
+                T* o) {
+  while (f1 != l1 && f2 != l2) {
+    if (*f1 < *f2) {
+      *o++ = *f1++;
+    } else if (*f2 < *f1) {
+      *o++ = *f2++;
+    } else {
+      *o++ = *f1++;
+      ++f2;
+    }
+  }
+  o = std::copy(f1, l1, o);
+  return std::copy(f2, l2, o);
+}
+
+template <typename I1, typename I2, typename O>
+using value_type_checked = std::enable_if_t<
+    std::is_same_v<equivalent<ValueType<I1>>, equivalent<ValueType<I2>>> &&
+        std::is_same_v<equivalent<ValueType<I1>>, equivalent<ValueType<O>>> &&
+        std::is_integral_v<equivalent<ValueType<I1>>>,
+    equivalent<ValueType<I1>>>;
+
+}  // namespace _set_operations
+
+// Every iteration compares a pack from each range: all pairs via rotations.
+// The pack with the smaller last element can't match anything further,
+// so it's done. Very skewed sizes and the tails use galloping search.
+template <std::size_t width, typename I1, typename I2, typename O>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         ContigiousIterator<O> && Integral<equivalent<ValueType<I1>>>
+O set_intersection(I1 _f1, I1 _l1, I2 _f2, I2 _l2, O _o) {
+  using T = _set_operations::value_type_checked<I1, I2, O>;
+  using pack = simd::pack<T, width>;
+  constexpr auto n = static_cast<std::ptrdiff_t>(width);
+
+  auto [f1, l1] = unsq::drill_down_range(_f1, _l1);
+  auto [f2, l2] = unsq::drill_down_range(_f2, _l2);
+  T* o = unsq::drill_down(_o);
+
+  if (_set_operations::skewed(l1 - f1, l2 - f2)) {
+    o = _set_operations::intersection_galloping(f1, l1, f2, l2, o);
+    return unsq::undo_drill_down(_o, o);
+  }
+
+  _set_operations::exact_writer<pack> out{o};
+
+  while (l1 - f1 >= n && l2 - f2 >= n) {
+    const pack xs = simd::load_unaligned<pack>(f1);
+    const pack ys = simd::load_unaligned<pack>(f2);
+    const auto matched =
+        simd::get_top_bits(_set_operations::any_equal(xs, ys));
+    if (matched) out.push(xs, matched);
+
+    const T x_last = f1[n - 1];
+    const T y_last = f2[n - 1];
+    if (x_last <= y_last) f1 += n;
+    if (y_last <= x_last) f2 += n;
+  }
+
+  o = out.finish();
+  o = _set_operations::intersection_galloping(f1, l1, f2, l2, o);
+  return unsq::undo_drill_down(_o, o);
+}
+
+// Elements of xs are only written when the pack is done: it might match
+// more than one pack of ys.
+template <std::size_t width, typename I1, typename I2, typename O>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         ContigiousIterator<O> && Integral<equivalent<ValueType<I1>>>
+O set_difference(I1 _f1, I1 _l1, I2 _f2, I2 _l2, O _o) {
+  using T = _set_operations::value_type_checked<I1, I2, O>;
+  using pack = simd::pack<T, width>;
+  using vbool = simd::vbool_t<pack>;
+  constexpr auto n = static_cast<std::ptrdiff_t>(width);
+
+  auto [f1, l1] = unsq::drill_down_range(_f1, _l1);
+  auto [f2, l2] = unsq::drill_down_range(_f2, _l2);
+  T* o = unsq::drill_down(_o);
+
+  if (_set_operations::skewed(l1 - f1, l2 - f2)) {
+    o = _set_operations::difference_galloping(f1, l1, f2, l2, o);
+    return unsq::undo_drill_down(_o, o);
+  }
+
+  _set_operations::exact_writer<pack> out{o};
+  vbool x_matched = simd::set_zero<vbool>();
+
+  while (l1 - f1 >= n && l2 - f2 >= n) {
+    const pack xs = simd::load_unaligned<pack>(f1);
+    const pack ys = simd::load_unaligned<pack>(f2);
+    x_matched |= _set_operations::any_equal(xs, ys);
+
+    const T x_last = f1[n - 1];
+    const T y_last = f2[n - 1];
+    if (x_last <= y_last) {
+      out.push(xs, simd::get_top_bits(~x_matched));
+      x_matched = simd::set_zero<vbool>();
+      f1 += n;
+    }
+    if (y_last <= x_last) f2 += n;
+  }
+
+  o = out.finish();
+
+  // The pack at f1 could have matched some of the elements before f2.
+  // Those are all smaller than *f2.
+  const auto matched = simd::to_array(x_matched);
+  for (std::size_t i = 0; i != width && f1 != l1; ++i, ++f1) {
+    if (f2 != l2 && !(*f1 < *f2)) break;
+    if (!matched[i]) *o++ = *f1;
+  }
+
+  o = _set_operations::difference_galloping(f1, l1, f2, l2, o);
+  return unsq::undo_drill_down(_o, o);
+}
+
+// The output of the union is a merge, all pairs comparisons don't help much
+// here. We only do galloping for very skewed sizes.
+template <std::size_t, typename I1, typename I2, typename O>
+// require ContigiousIterator<I1> && ContigiousIterator<I2> &&
+//         ContigiousIterator<O> && Integral<equivalent<ValueType<I1>>>
+O set_union(I1 _f1, I1 _l1, I2 _f2, I2 _l2, O _o) {
+  using T = _set_operations::value_type_checked<I1, I2, O>;
+
+  auto [f1, l1] = unsq::drill_down_range(_f1, _l1);
+  auto [f2, l2] = unsq::drill_down_range(_f2, _l2);
+  T* o = unsq::drill_down(_o);
+
+  if (_set_operations::skewed(l1 - f1, l2 - f2)) {
+    o = _set_operations::union_galloping(f1, l1, f2, l2, o);
+  } else {
+    o = _set_operations::union_linear(f1, l1, f2, l2, o);
+  }
+  return unsq::undo_drill_down(_o, o);
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_SET_OPERATIONS_H_
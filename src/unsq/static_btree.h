@@ -0,0 +1,146 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UNSQ_STATIC_BTREE_H_
+#define UNSQ_STATIC_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "simd/pack.h"
+#include "unsq/lower_bound.h"
+
+namespace unsq {
+namespace _static_btree {
+
+constexpr std::size_t kNodeBytes = 64;
+
+struct node_aligned_deleter {
+  template <typename T>
+  void operator()(T* ptr) {
+    ::operator delete[](ptr, std::align_val_t{kNodeBytes});
+  }
+};
+
+// Compares bigger than anything we can look up.
+template <typename T>
+constexpr T padding() {
+  if constexpr (std::numeric_limits<T>::has_infinity) {
+    return std::numeric_limits<T>::infinity();
+  } else {
+    return std::numeric_limits<T>::max();
+  }
+}
+
+}  // namespace _static_btree
+
+// Static B+ tree (S+ tree from https://algorithmica.org/en/b-tree).
+//
+// Every node is a cache line of keys. The last layer is the sorted data
+// padded to whole nodes, every layer above has an (n + 1)-th part of the
+// nodes. Key i of a node is the smallest element of its child i + 1,
+// so the number of keys less than the value is the child to go to.
+// Nodes are compared with simd packs.
+//
+// Immutable, lower_bound returns the position in sorted order.
+template <typename T, std::size_t width>
+// require Arithmetic<T>
+class static_btree {
+ public:
+  using value_type = T;
+
+  static constexpr std::size_t node_size =
+      _static_btree::kNodeBytes / sizeof(T);
+
+ private:
+  using pack = simd::pack<T, width>;
+  static_assert(node_size % width == 0);
+
+  std::unique_ptr<T[], _static_btree::node_aligned_deleter> body_;
+  std::vector<std::size_t> layers_;  // Offsets, leaves first, root last.
+  std::size_t size_ = 0;
+
+  static std::size_t count_less(const T* node, const pack& x) {
+    std::size_t res = 0;
+    for (std::size_t i = 0; i != node_size; i += width) {
+      res += _lower_bound::count_less(simd::load<pack>(node + i), x);
+    }
+    return res;
+  }
+
+ public:
+  template <typename I>
+  // require ForwardIterator<I> && ValueType<I> == T && sorted(f, l)
+  static_btree(I f, I l)
+      : size_(static_cast<std::size_t>(std::distance(f, l))) {
+    std::vector<std::size_t> layer_nodes{
+        std::max<std::size_t>(1, (size_ + node_size - 1) / node_size)};
+    while (layer_nodes.back() > 1) {
+      layer_nodes.push_back((layer_nodes.back() + node_size) / (node_size + 1));
+    }
+
+    std::size_t total = 0;
+    for (std::size_t nodes : layer_nodes) {
+      layers_.push_back(total);
+      total += nodes * node_size;
+    }
+
+    body_.reset(new (std::align_val_t{_static_btree::kNodeBytes}) T[total]);
+    std::fill(std::copy(f, l, body_.get()), body_.get() + total,
+              _static_btree::padding<T>());
+
+    // A node of the layer h - 1 covers (node_size + 1)^(h - 1) leaves.
+    std::size_t leaves_per_child = 1;
+    for (std::size_t h = 1; h != layer_nodes.size(); ++h) {
+      T* layer = body_.get() + layers_[h];
+      for (std::size_t node = 0; node != layer_nodes[h]; ++node) {
+        for (std::size_t i = 0; i != node_size; ++i) {
+          const std::size_t child = node * (node_size + 1) + i + 1;
+          const std::size_t first = child * leaves_per_child * node_size;
+          if (first < size_) layer[node * node_size + i] = body_[first];
+        }
+      }
+      leaves_per_child *= node_size + 1;
+    }
+  }
+
+  std::size_t size() const { return size_; }
+
+  // Number of elements less than v.
+  std::size_t lower_bound(const T& v) const {
+    const pack x = simd::set_all<pack>(v);
+
+    std::size_t node = 0;
+    for (std::size_t h = layers_.size() - 1; h != 0; --h) {
+      const T* keys = body_.get() + layers_[h] + node * node_size;
+      node = node * (node_size + 1) + count_less(keys, x);
+    }
+
+    const std::size_t res =
+        node * node_size + count_less(body_.get() + node * node_size, x);
+    return std::min(res, size_);
+  }
+};
+
+}  // namespace unsq
+
+#endif  // UNSQ_STATIC_BTREE_H_
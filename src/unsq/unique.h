@@ -0,0 +1,114 @@
+/*
+ * Copyright 2020 Denis Yaroshevskiy
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UNSQ_UNIQUE_H_
+#define UNSQ_UNIQUE_H_
+
+#include "simd/pack.h"
+#include "unsq/drill_down.h"
+#include "unsq/remove.h"
+
+namespace unsq {
+namespace _unique {
+
+// Element i of the result is element i - 1 of xs, `lane` gets the last
+// element of the previous pack. The previous pack is carried in a register:
+// in place we might have already overwritten it in memory.
+template <typename Pack>
+Pack previous_elements(const Pack& xs, const Pack& carry,
+                       const simd::vbool_t<Pack>& lane) {
+  return simd::blend(simd::shift_elements_right<1>(xs), carry, lane);
+}
+
+template <typename Pack>
+simd::vbool_t<Pack> nth_lane(std::uint32_t n) {
+  using vbool = simd::vbool_t<Pack>;
+  return simd::spread_top_bits(simd::ignore_first_n_mask<vbool>(n) &
+                               ~simd::ignore_first_n_mask<vbool>(n + 1));
+}
+
+}  // namespace _unique
+
+template <std::size_t width, typename I>
+// require ContigiousIterator<I>
+I unique(I _f, I _l) {
+  using T = equivalent<ValueType<I>>;
+  using pack = simd::pack<T, width>;
+  using vbool = simd::vbool_t<pack>;
+
+  if (_f == _l) return _l;
+
+  auto [f, l] = unsq::drill_down_range(_f, _l);
+
+  // The first element always stays.
+  pack carry = simd::set_all<pack>(*f);
+  T* o = ++f;
+
+  const vbool first_lane = _unique::nth_lane<pack>(0);
+
+  while (l - f >= static_cast<std::ptrdiff_t>(width)) {
+    const pack ts = simd::load_unaligned<pack>(f);
+    const pack prev = _unique::previous_elements(ts, carry, first_lane);
+    const auto mmask = simd::get_top_bits(~simd::equal_pairwise(ts, prev));
+
+    o = simd::compress_store_unsafe(o, ts, mmask);
+    carry = simd::broadcast_last(ts);
+    f += width;
+  }
+
+  if (f == l) return unsq::undo_drill_down(_f, o);
+
+  // The load can start before f, elements there might have been overwritten.
+  auto [safe, mmask_filter] = _remove::figure_out_safe_load<pack>(f, l);
+  const auto lane_f = static_cast<std::uint32_t>(f - safe);
+
+  const pack ts = simd::load_unaligned<pack>(safe);
+  const pack prev = _unique::previous_elements(
+      ts, carry, _unique::nth_lane<pack>(lane_f));
+  auto mmask = simd::get_top_bits(~simd::equal_pairwise(ts, prev));
+  mmask &= mmask_filter;
+
+  o = simd::compress_store_masked(o, ts, mmask);
+  return unsq::undo_drill_down(_f, o);
+}
+
+template <std::size_t width, typename I, typename O>
+// require ContigiousIterator<I> && ContigiousIterator<O>
+O unique_copy(I f, I l, O o) {
+  using pack = simd::pack<equivalent<ValueType<I>>, width>;
+
+  if (f == l) return o;
+
+  // The first element always goes.
+  *o = *f;
+  ++o;
+
+  // Packs come in order. The last one can overlap with the previous ones,
+  // but the input is not modified, so everything before lane 0 is correct.
+  pack carry = simd::set_all<pack>(equivalent_cast(*f));
+  const auto first_lane = _unique::nth_lane<pack>(0);
+
+  return _remove::copy_selected<width>(++f, l, o, [&](const pack& ts) {
+    const pack prev = _unique::previous_elements(ts, carry, first_lane);
+    carry = simd::broadcast_last(ts);
+    return simd::get_top_bits(~simd::equal_pairwise(ts, prev));
+  });
+}
+
+}  // namespace unsq
+
+#endif  // UNSQ_UNIQUE_H_